@@ -0,0 +1,272 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <map>
+#include <fstream>   // Para leer los corpus y la baseline
+#include <sstream>
+#include <chrono>    // Para medir el tiempo de cada backend
+#include <iomanip>   // Para formatear la tabla de resultados
+#include "sudokus.h"      // Archivo con las representaciones de tableros de Sudoku
+#include "Secuencial.h"   // Backend secuencial recursivo
+#include "paralelo.h"     // Backend por filas con hilos
+#include "propagacion.h"  // Backend con propagacin por oleadas
+#include "checkpoint.h"   // Backend iterativo con contador de nodos
+#include "sesion.h"       // Backend de la sesin incremental
+#include "benchmark.h"
+
+// Resultado de un backend sobre un Sudoku
+enum ResultadoBackend {
+	BACKEND_SIN_SOLUCION,
+	BACKEND_RESUELTO,
+	BACKEND_LIMITE  // Se alcanz LIMITE_NODOS_BENCHMARK sin terminar
+};
+
+typedef ResultadoBackend(*FuncionBackend)(int** board, int size, unsigned long long& nodos);
+
+struct BackendBenchmark {
+	const char* nombre;
+	FuncionBackend resolver;
+	bool nodosDeterministas;  // Solo entonces los nodos se comparan con la baseline
+};
+
+// Mediciones acumuladas de un backend sobre un nivel de un tamao
+struct MedicionBenchmark {
+	double tiempoMs = 0.0;
+	unsigned long long nodos = 0;
+	int puzzles = 0;
+	int fallos = 0;  // Soluciones invlidas o resultado distinto del esperado
+};
+
+// Backtracking recursivo de Secuencial.cpp limitado a LIMITE_NODOS_BENCHMARK nodos
+static ResultadoBackend backendSecuencial(int** board, int size, unsigned long long& nodos) {
+	nodos = 0;
+	if (solveSudokuLimitado(board, size, 0, 0, nodos, LIMITE_NODOS_BENCHMARK)) return BACKEND_RESUELTO;
+	return nodos >= LIMITE_NODOS_BENCHMARK ? BACKEND_LIMITE : BACKEND_SIN_SOLUCION;
+}
+
+// Filas con hilos y combinacin validada, limitado a LIMITE_NODOS_BENCHMARK nodos
+static ResultadoBackend backendParalelo(int** board, int size, unsigned long long& nodos) {
+	int filasPendientes = 0;
+	bool usoRespaldo = false;
+	if (resolverConHilosValidado(board, size, filasPendientes, usoRespaldo, nodos, LIMITE_NODOS_BENCHMARK)) return BACKEND_RESUELTO;
+	return nodos >= LIMITE_NODOS_BENCHMARK ? BACKEND_LIMITE : BACKEND_SIN_SOLUCION;
+}
+
+// Backtracking iterativo limitado a LIMITE_NODOS_BENCHMARK nodos
+static ResultadoBackend resolverIterativoLimitado(int** board, int size, unsigned long long& nodos) {
+	EstadoBusqueda estado;
+	bool resuelto = solveSudokuConCheckpoint(board, size, "", INTERVALO_CHECKPOINT_NODOS, estado,
+		[&estado]() { return estado.nodos >= LIMITE_NODOS_BENCHMARK; });
+	nodos = estado.nodos;
+	if (estado.detenida) return BACKEND_LIMITE;
+	return resuelto ? BACKEND_RESUELTO : BACKEND_SIN_SOLUCION;
+}
+
+static ResultadoBackend backendIterativo(int** board, int size, unsigned long long& nodos) {
+	return resolverIterativoLimitado(board, size, nodos);
+}
+
+// Propagacin por oleadas y backtracking iterativo sobre lo que quede
+static ResultadoBackend backendOleadas(int** board, int size, unsigned long long& nodos) {
+	EstadisticasPropagacion estadisticas = propagarPorOleadas(board, size);
+	if (estadisticas.contradiccion) {
+		nodos = 0;
+		return BACKEND_SIN_SOLUCION;
+	}
+	return resolverIterativoLimitado(board, size, nodos);
+}
+
+// Bsqueda con mscaras de la sesin incremental
+static ResultadoBackend backendSesion(int** board, int size, unsigned long long& nodos) {
+	std::vector<std::vector<int>> tablero(size, std::vector<int>(size));
+	for (int i = 0; i < size; i++) {
+		std::copy(board[i], board[i] + size, tablero[i].begin());
+	}
+	SesionSudoku sesion;
+	nodos = 0;
+	if (!iniciarSesion(sesion, tablero) || !sigueResoluble(sesion)) return BACKEND_SIN_SOLUCION;
+	nodos = sesion.nodosBusqueda;
+	for (int c = 0; c < size * size; c++) {
+		board[c / size][c % size] = sesion.solucionCacheada[c];
+	}
+	return BACKEND_RESUELTO;
+}
+
+static const BackendBenchmark BACKENDS[] = {
+	{ "secuencial", backendSecuencial, true },
+	// Los hilos comparten restricciones y filasResueltas, as que los nodos cambian en cada ejecucin
+	{ "paralelo", backendParalelo, false },
+	{ "iterativo", backendIterativo, true },
+	{ "oleadas", backendOleadas, true },
+	{ "sesion", backendSesion, true },
+};
+
+static const int DIMENSIONES_BENCHMARK[] = { 9, 16, 25 };
+static const char* NIVELES_BENCHMARK[] = { "facil", "dificil", "patologico", "irresoluble" };
+
+std::vector<std::vector<std::vector<int>>> cargarCorpus(const std::string& ruta, int dimension) {
+	std::vector<std::vector<std::vector<int>>> corpus;
+	// Las mscaras de la propagacin y de la sesin no admiten tableros mayores
+	if (dimension <= 0 || dimension > DIMENSION_MAXIMA_MASCARA) return corpus;
+	std::ifstream entrada(ruta);
+	std::vector<std::vector<int>> actual;
+	std::string linea;
+
+	while (true) {
+		bool hayLinea = static_cast<bool>(std::getline(entrada, linea));
+		if (hayLinea && !linea.empty() && linea[0] == '#') continue;
+
+		std::istringstream numeros(hayLinea ? linea : "");
+		std::vector<int> fila;
+		int num;
+		while (numeros >> num) fila.push_back(num);
+
+		if (!fila.empty()) {
+			actual.push_back(fila);
+		}
+		else if (!actual.empty()) {
+			// Fin de bloque: solo se aceptan tableros del tamao del archivo con nmeros en 0..dimension
+			bool valido = static_cast<int>(actual.size()) == dimension;
+			for (const auto& f : actual) {
+				valido = valido && static_cast<int>(f.size()) == dimension;
+				for (int num : f) valido = valido && num >= 0 && num <= dimension;
+			}
+			if (valido) corpus.push_back(actual);
+			else std::cout << "Tablero mal formado en " << ruta << ", se ignora." << std::endl;
+			actual.clear();
+		}
+		if (!hayLinea) break;
+	}
+	return corpus;
+}
+
+// Clave de una medicin en la baseline
+static std::string claveMedicion(const std::string& backend, int dimension, const std::string& nivel) {
+	return backend + " " + std::to_string(dimension) + " " + nivel;
+}
+
+// Lee la baseline: una lnea "backend dimension nivel tiempo_ms nodos" por medicin
+static std::map<std::string, MedicionBenchmark> cargarBaseline(const std::string& ruta) {
+	std::map<std::string, MedicionBenchmark> baseline;
+	std::ifstream entrada(ruta);
+	std::string linea;
+	while (std::getline(entrada, linea)) {
+		if (linea.empty() || linea[0] == '#') continue;
+		std::istringstream campos(linea);
+		std::string backend, nivel;
+		int dimension;
+		MedicionBenchmark medicion;
+		if (campos >> backend >> dimension >> nivel >> medicion.tiempoMs >> medicion.nodos) {
+			baseline[claveMedicion(backend, dimension, nivel)] = medicion;
+		}
+	}
+	return baseline;
+}
+
+static bool guardarBaseline(const std::string& ruta, const std::vector<std::pair<std::string, MedicionBenchmark>>& mediciones) {
+	std::ofstream salida(ruta, std::ios::trunc);
+	if (!salida) return false;
+	salida << "# Baseline del benchmark de regresin (tiempo total por nivel y nodos explorados)." << std::endl;
+	salida << "# Los nodos se comparan siempre; el tiempo solo con --tiempo y en la mquina de referencia." << std::endl;
+	salida << "# Regenerar con: --benchmark-baseline <directorio>" << std::endl;
+	salida << "# backend dimension nivel tiempo_ms nodos" << std::endl;
+	for (const auto& item : mediciones) {
+		salida << item.first << " " << std::fixed << std::setprecision(3) << item.second.tiempoMs
+			<< " " << item.second.nodos << std::endl;
+	}
+	return true;
+}
+
+int ejecutarBenchmark(const std::string& directorio, double umbral, bool compararTiempo, bool actualizarBaseline) {
+	std::string rutaBaseline = directorio + "/baseline.txt";
+	std::map<std::string, MedicionBenchmark> baseline = cargarBaseline(rutaBaseline);
+	std::vector<std::pair<std::string, MedicionBenchmark>> mediciones;
+	bool hayFallos = false;
+
+	std::cout << std::left << std::setw(12) << "backend" << std::setw(8) << "tamao" << std::setw(13) << "nivel"
+		<< std::right << std::setw(8) << "puzzles" << std::setw(12) << "tiempo ms" << std::setw(12) << "nodos"
+		<< std::setw(12) << "base ms" << std::setw(12) << "base nodos" << "  estado" << std::endl;
+
+	for (int dimension : DIMENSIONES_BENCHMARK) {
+		for (const char* nivel : NIVELES_BENCHMARK) {
+			std::string rutaCorpus = directorio + "/corpus/" + std::to_string(dimension) + "x" + std::to_string(dimension)
+				+ "_" + nivel + ".txt";
+			std::vector<std::vector<std::vector<int>>> corpus = cargarCorpus(rutaCorpus, dimension);
+			if (corpus.empty()) continue;
+			bool esperadoResoluble = std::string(nivel) != "irresoluble";
+
+			for (const BackendBenchmark& backend : BACKENDS) {
+				MedicionBenchmark medicion;
+				for (const auto& tablero : corpus) {
+					int size = tablero.size();
+					int** board = initializeBoard(tablero);
+					int** inicial = copiarTablero(board, size);
+
+					unsigned long long nodos = 0;
+					auto inicio = std::chrono::high_resolution_clock::now();
+					ResultadoBackend resultado = backend.resolver(board, size, nodos);
+					auto fin = std::chrono::high_resolution_clock::now();
+
+					medicion.tiempoMs += std::chrono::duration<double, std::milli>(fin - inicio).count();
+					medicion.nodos += nodos;
+					medicion.puzzles++;
+					// Toda solucin se valida: un tablero impreso como resuelto debe serlo
+					bool correcto = resultado == BACKEND_RESUELTO
+						? esperadoResoluble && validarSolucion(board, inicial, size)
+						: resultado == BACKEND_SIN_SOLUCION && !esperadoResoluble;
+					if (!correcto) medicion.fallos++;
+
+					freeBoard(inicial, size);
+					freeBoard(board, size);
+				}
+
+				std::string clave = claveMedicion(backend.nombre, dimension, nivel);
+				mediciones.push_back({ clave, medicion });
+
+				std::string estado = "ok";
+				auto base = baseline.find(clave);
+				if (medicion.fallos > 0) {
+					estado = "FALLO (" + std::to_string(medicion.fallos) + " incorrectos)";
+				}
+				else if (base == baseline.end()) {
+					estado = "sin baseline";
+				}
+				else if (!actualizarBaseline) {
+					if (backend.nodosDeterministas && medicion.nodos > base->second.nodos * umbral) {
+						estado = "REGRESION de nodos";
+					}
+					else if (compararTiempo && medicion.tiempoMs > base->second.tiempoMs * umbral + MARGEN_TIEMPO_BENCHMARK_MS) {
+						estado = "REGRESION de tiempo";
+					}
+				}
+				if (estado != "ok" && estado != "sin baseline") hayFallos = true;
+
+				std::cout << std::left << std::setw(12) << backend.nombre << std::setw(8) << dimension << std::setw(13) << nivel
+					<< std::right << std::setw(8) << medicion.puzzles << std::setw(12) << std::fixed << std::setprecision(2) << medicion.tiempoMs
+					<< std::setw(12) << medicion.nodos;
+				if (base != baseline.end()) {
+					std::cout << std::setw(12) << base->second.tiempoMs << std::setw(12) << base->second.nodos;
+				}
+				else {
+					std::cout << std::setw(12) << "-" << std::setw(12) << "-";
+				}
+				std::cout << "  " << estado << std::endl;
+			}
+		}
+	}
+	std::cout.unsetf(std::ios::fixed);
+	std::cout << std::setprecision(6);
+
+	if (mediciones.empty()) {
+		std::cout << "No se encontraron corpus en " << directorio << "/corpus." << std::endl;
+		return 1;
+	}
+	if (actualizarBaseline) {
+		if (guardarBaseline(rutaBaseline, mediciones)) std::cout << "Baseline actualizada en " << rutaBaseline << std::endl;
+		else std::cout << "No se pudo escribir " << rutaBaseline << std::endl;
+	}
+
+	std::cout << (hayFallos ? "Benchmark con fallos o regresiones (umbral " : "Benchmark correcto (umbral ")
+		<< umbral << "x, " << (compararTiempo ? "nodos y tiempo" : "solo nodos") << ")." << std::endl;
+	return hayFallos ? 1 : 0;
+}
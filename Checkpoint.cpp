@@ -0,0 +1,268 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <fstream>   // Para leer y escribir los checkpoints
+#include <cstdio>    // Para std::remove
+#include <filesystem> // Para reemplazar el checkpoint con un renombrado atmico
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "sudokus.h"     // Archivo con las representaciones de tableros de Sudoku
+#include "Secuencial.h"  // isSafe sobre int**
+#include "checkpoint.h"
+
+// Formato del checkpoint (little-endian):
+//   "SDKC" | versin (1 byte) | size (2) | huella (8) | nodos (8) | retrocesos (8)
+//   | profundidad (4) | un byte por nivel del rastro con el nmero colocado
+static const unsigned char MAGIA_CHECKPOINT[4] = { 'S', 'D', 'K', 'C' };
+static const unsigned char VERSION_CHECKPOINT = 1;
+
+static void escribirEntero(std::vector<unsigned char>& datos, unsigned long long valor, int bytes) {
+	for (int i = 0; i < bytes; i++) {
+		datos.push_back(static_cast<unsigned char>(valor >> (8 * i)));
+	}
+}
+
+static unsigned long long leerEntero(const std::vector<unsigned char>& datos, size_t& pos, int bytes) {
+	unsigned long long valor = 0;
+	for (int i = 0; i < bytes; i++) {
+		valor |= static_cast<unsigned long long>(datos[pos++]) << (8 * i);
+	}
+	return valor;
+}
+
+// Escribe en un archivo temporal y lo renombra, para no dejar nunca un checkpoint a medias
+static bool escribirArchivo(const std::string& ruta, const std::vector<unsigned char>& datos) {
+	std::string temporal = ruta + ".tmp";
+	{
+		std::ofstream salida(temporal, std::ios::binary | std::ios::trunc);
+		if (!salida) return false;
+		salida.write(reinterpret_cast<const char*>(datos.data()), datos.size());
+		if (!salida) return false;
+	}
+	// filesystem::rename reemplaza el destino tambin en Windows (std::rename no), as que
+	// nunca hay un momento sin checkpoint en disco
+	std::error_code ec;
+	std::filesystem::rename(temporal, ruta, ec);
+	return !ec;
+}
+
+// Bucle del hilo escritor
+static void bucleEscritor(EscritorCheckpoint* escritor) {
+	std::unique_lock<std::mutex> lock(escritor->mtx);
+	while (true) {
+		escritor->cv.wait(lock, [escritor] { return escritor->hayPendiente || escritor->terminar; });
+		if (escritor->hayPendiente) {
+			std::vector<unsigned char> datos;
+			datos.swap(escritor->pendiente);
+			escritor->hayPendiente = false;
+			// La escritura se hace sin el mutex para no frenar a la bsqueda
+			lock.unlock();
+			if (!escribirArchivo(escritor->ruta, datos)) {
+				std::cout << "No se pudo escribir el checkpoint " << escritor->ruta << std::endl;
+			}
+			lock.lock();
+		}
+		else if (escritor->terminar) {
+			break;
+		}
+	}
+}
+
+void iniciarEscritor(EscritorCheckpoint& escritor, const std::string& ruta) {
+	escritor.ruta = ruta;
+	escritor.terminar = false;
+	escritor.hayPendiente = false;
+	escritor.hilo = std::thread(bucleEscritor, &escritor);
+}
+
+void programarCheckpoint(EscritorCheckpoint& escritor, std::vector<unsigned char>&& datos) {
+	{
+		std::lock_guard<std::mutex> lock(escritor.mtx);
+		escritor.pendiente = std::move(datos);
+		escritor.hayPendiente = true;
+	}
+	escritor.cv.notify_one();
+}
+
+void detenerEscritor(EscritorCheckpoint& escritor) {
+	{
+		std::lock_guard<std::mutex> lock(escritor.mtx);
+		escritor.terminar = true;
+	}
+	escritor.cv.notify_one();
+	if (escritor.hilo.joinable()) escritor.hilo.join();
+}
+
+std::vector<unsigned char> serializarEstado(const EstadoBusqueda& estado, int size, unsigned long long huella) {
+	std::vector<unsigned char> datos;
+	datos.reserve(35 + estado.profundidad);
+	for (int i = 0; i < 4; i++) datos.push_back(MAGIA_CHECKPOINT[i]);
+	datos.push_back(VERSION_CHECKPOINT);
+	escribirEntero(datos, size, 2);
+	escribirEntero(datos, huella, 8);
+	escribirEntero(datos, estado.nodos, 8);
+	escribirEntero(datos, estado.retrocesos, 8);
+	escribirEntero(datos, estado.profundidad, 4);
+	for (int k = 0; k < estado.profundidad; k++) {
+		datos.push_back(static_cast<unsigned char>(estado.valores[k]));
+	}
+	return datos;
+}
+
+bool cargarCheckpoint(const std::string& ruta, int size, unsigned long long huella, EstadoBusqueda& estado) {
+	std::ifstream entrada(ruta, std::ios::binary);
+	if (!entrada) return false;
+	std::vector<unsigned char> datos((std::istreambuf_iterator<char>(entrada)), std::istreambuf_iterator<char>());
+
+	const size_t cabecera = 35;
+	if (datos.size() < cabecera) return false;
+	for (int i = 0; i < 4; i++) {
+		if (datos[i] != MAGIA_CHECKPOINT[i]) return false;
+	}
+	if (datos[4] != VERSION_CHECKPOINT) return false;
+
+	size_t pos = 5;
+	if (static_cast<int>(leerEntero(datos, pos, 2)) != size) return false;
+	if (leerEntero(datos, pos, 8) != huella) return false;
+	unsigned long long nodos = leerEntero(datos, pos, 8);
+	unsigned long long retrocesos = leerEntero(datos, pos, 8);
+	unsigned long long profundidad = leerEntero(datos, pos, 4);
+	if (profundidad > estado.vacias.size() || datos.size() != cabecera + profundidad) return false;
+
+	for (size_t k = 0; k < profundidad; k++) {
+		int num = datos[pos++];
+		if (num < 1 || num > size) return false;
+		estado.valores[k] = num;
+	}
+	estado.profundidad = static_cast<int>(profundidad);
+	estado.nodos = nodos;
+	estado.retrocesos = retrocesos;
+	return true;
+}
+
+unsigned long long huellaTablero(int** board, int size) {
+	unsigned long long huella = 1469598103934665603ULL;
+	for (int i = 0; i < size; i++) {
+		for (int j = 0; j < size; j++) {
+			huella ^= static_cast<unsigned long long>(board[i][j]);
+			huella *= 1099511628211ULL;
+		}
+	}
+	return huella;
+}
+
+bool solveSudokuConCheckpoint(int** board, int size, const std::string& rutaCheckpoint,
+	unsigned long long intervaloNodos, EstadoBusqueda& estado,
+	const std::function<bool()>& detener) {
+	unsigned long long huella = huellaTablero(board, size);
+
+	estado = EstadoBusqueda();
+	for (int i = 0; i < size; i++) {
+		for (int j = 0; j < size; j++) {
+			if (board[i][j] == 0) estado.vacias.push_back(i * size + j);
+		}
+	}
+	estado.valores.assign(estado.vacias.size(), 0);
+
+	bool usarCheckpoint = !rutaCheckpoint.empty() && size <= 255;
+	if (usarCheckpoint && cargarCheckpoint(rutaCheckpoint, size, huella, estado)) {
+		// Volver a colocar el rastro guardado; el resto de la frontera est implcito en l.
+		// Cada nmero se comprueba con isSafe para no continuar desde un tablero invlido.
+		int colocados = 0;
+		while (colocados < estado.profundidad) {
+			int celda = estado.vacias[colocados];
+			int num = estado.valores[colocados];
+			if (!isSafe(board, size, celda / size, celda % size, num)) break;
+			board[celda / size][celda % size] = num;
+			colocados++;
+		}
+		if (colocados == estado.profundidad) {
+			std::cout << "Reanudando desde el checkpoint (profundidad " << estado.profundidad
+				<< ", nodos " << estado.nodos << ")." << std::endl;
+		}
+		else {
+			// Rastro en conflicto: deshacerlo y empezar la bsqueda desde cero
+			for (int k = 0; k < colocados; k++) {
+				int celda = estado.vacias[k];
+				board[celda / size][celda % size] = 0;
+			}
+			estado.valores.assign(estado.vacias.size(), 0);
+			estado.profundidad = 0;
+			estado.nodos = 0;
+			estado.retrocesos = 0;
+			std::cout << "El checkpoint contiene un nmero en conflicto (profundidad " << colocados
+				<< "), se descarta." << std::endl;
+		}
+	}
+
+	EscritorCheckpoint escritor;
+	if (usarCheckpoint) iniciarEscritor(escritor, rutaCheckpoint);
+
+	int total = static_cast<int>(estado.vacias.size());
+	bool resuelto = false;
+	while (true) {
+		if (estado.profundidad == total) {
+			resuelto = true;
+			break;
+		}
+		if (estado.profundidad < 0) break;
+
+		int celda = estado.vacias[estado.profundidad];
+		int fila = celda / size, col = celda % size;
+		board[fila][col] = 0; // Quitar el nmero anterior antes de probar el siguiente
+
+		int num = estado.valores[estado.profundidad] + 1;
+		while (num <= size && !isSafe(board, size, fila, col, num)) num++;
+
+		if (num <= size) {
+			board[fila][col] = num;
+			estado.valores[estado.profundidad] = num;
+			estado.profundidad++;
+			estado.nodos++;
+			if (usarCheckpoint && intervaloNodos != 0 && estado.nodos % intervaloNodos == 0) {
+				programarCheckpoint(escritor, serializarEstado(estado, size, huella));
+			}
+			if (detener && estado.nodos % INTERVALO_DETENCION_NODOS == 0 && detener()) {
+				estado.detenida = true;
+				if (usarCheckpoint) programarCheckpoint(escritor, serializarEstado(estado, size, huella));
+				break;
+			}
+		}
+		else {
+			// Backtrack: este nivel queda agotado y se vuelve al anterior
+			estado.valores[estado.profundidad] = 0;
+			estado.profundidad--;
+			estado.retrocesos++;
+		}
+	}
+
+	if (usarCheckpoint) {
+		detenerEscritor(escritor);
+		// La bsqueda termin, el checkpoint ya no sirve para reanudar
+		if (!estado.detenida) std::remove(rutaCheckpoint.c_str());
+	}
+	if (estado.profundidad < 0) estado.profundidad = 0;
+	return resuelto;
+}
+
+void resolverSudokuConCheckpoint(const std::vector<std::vector<int>>& initialBoard) {
+	int size = initialBoard.size();
+	int** board = initializeBoard(initialBoard);
+
+	std::cout << "Sudoku a resolver:" << std::endl;
+	printBoard(board, size);
+
+	std::string ruta = "checkpoint_" + std::to_string(size) + "x" + std::to_string(size) + ".bin";
+	EstadoBusqueda estado;
+	if (solveSudokuConCheckpoint(board, size, ruta, INTERVALO_CHECKPOINT_NODOS, estado)) {
+		std::cout << "Sudoku resuelto:" << std::endl;
+		printBoard(board, size);
+	}
+	else {
+		std::cout << "No se pudo resolver el Sudoku." << std::endl;
+	}
+	std::cout << "Nodos explorados: " << estado.nodos << ", retrocesos: " << estado.retrocesos << std::endl;
+
+	freeBoard(board, size);
+}
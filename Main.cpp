@@ -9,119 +9,116 @@
 #include <omp.h>
 #include <random>
 #include <iomanip> // Para formatear la salida
+#include <string>
+#include <cstdlib> // Para std::strtol y std::strtod en los argumentos de línea de comandos
+#include <climits> // Para INT_MAX
+#include <algorithm> // Para std::min
 #include "Secuencial.h"
 #include "paralelo.h"
 #include "sudokus.h"
+#include "propagacion.h"
+#include "checkpoint.h"
+#include "shards.h"
+#include "sesion.h"
+#include "benchmark.h"
 
 using namespace std;
 // Mutex para gestionar acceso a variables compartidas
 
-void menuPrincipal();
+void menuPrincipal(const std::string& programa);
 
 // Cambiado a std::mutex para evitar ambigüedad
 
 const int NUM_HILOS = 8;
 
-// Llamada a la función `resolverSudoku` pasando el objeto `board25x25_dificultad_media`
-void resolver25x25() {
-	resolverSudoku(board25x25_dificultad_media);
-}
-void resolver25x25p() {
-	resolverSudokuConHilos(board25x25_dificultad_media);
+// Tablero de ejemplo según su dimensión (9, 16 o 25), nullptr si no hay ninguno
+std::vector<std::vector<int>>* tableroPorDimension(int dimension) {
+	switch (dimension) {
+	case 9:
+		return &board9x9_dificultad_media;
+	case 16:
+		return &board16x16_dificultad_media;
+	case 25:
+		return &board25x25_dificultad_media;
+	default:
+		return nullptr;
+	}
 }
 
-// Llamada a la función `resolverSudoku` pasando el objeto `board16x16_dificultad_media`
-void resolver16x16() {
-	resolverSudoku(board16x16_dificultad_media);
-}
-void resolver16x16p() {
-	resolverSudokuConHilos(board16x16_dificultad_media);
-}
+// Submenú de tamaño común a todas las opciones; nullptr si la opción no es válida
+std::vector<std::vector<int>>* elegirTablero() {
+	std::cout << "\n=== Elija el tamaño del Sudoku ===" << std::endl;
+	std::cout << "1. Sudoku 9x9" << std::endl;
+	std::cout << "2. Sudoku 16x16" << std::endl;
+	std::cout << "3. Sudoku 25x25" << std::endl;
+	std::cout << "Elija una opción: ";
 
-// Llamada a la función `resolverSudoku` pasando el objeto `board9x9_dificultad_media`
-void resolver9x9() {
-	resolverSudoku(board9x9_dificultad_media);
-}
-void resolver9x9p() {
-	resolverSudokuConHilos(board9x9_dificultad_media);
+	int opcionSudoku;
+	if (!leerEntero(opcionSudoku)) return nullptr;
+	switch (opcionSudoku) {
+	case 1:
+		return tableroPorDimension(9);
+	case 2:
+		return tableroPorDimension(16);
+	case 3:
+		return tableroPorDimension(25);
+	default:
+		return nullptr;
+	}
 }
 
 // Menú principal
-void menuPrincipal() {
+void menuPrincipal(const std::string& programa) {
 	int opcionPrincipal;
-	int opcionSudoku;
 
 	while (true) {
 		std::cout << "=== MENU PRINCIPAL ===" << std::endl;
 		std::cout << "1. Solucionar Sudoku sin paralelizar" << std::endl;
 		std::cout << "2. Solucionar Sudoku con técnicas de paralelización (por filas)" << std::endl;
 		std::cout << "3. Verificar cantidad de hilos disponibles" << std::endl;
-		std::cout << "4. Salir" << std::endl;
+		std::cout << "4. Solucionar Sudoku con propagación por oleadas paralelas" << std::endl;
+		std::cout << "5. Solucionar Sudoku con checkpoints (reanuda si existe uno)" << std::endl;
+		std::cout << "6. Solucionar Sudoku repartiendo shards entre procesos" << std::endl;
+		std::cout << "7. Sesión interactiva (editar casillas y pedir pistas)" << std::endl;
+		std::cout << "8. Ejecutar benchmark de regresión" << std::endl;
+		std::cout << "0. Salir" << std::endl;
 		std::cout << "Elija una opción: ";
-		std::cin >> opcionPrincipal;
 
-		if (opcionPrincipal == 4) {
+		if (!leerEntero(opcionPrincipal)) {
+			if (std::cin.eof()) break;
+			std::cout << "Opción no válida." << std::endl << std::endl;
+			continue;
+		}
+		if (opcionPrincipal == 0) {
 			std::cout << "Saliendo del programa..." << std::endl;
 			break;
 		}
 
 		switch (opcionPrincipal) {
-		case 1: {
-			std::cout << "\n=== Elija el tamaño del Sudoku ===" << std::endl;
-			std::cout << "1. Sudoku 9x9" << std::endl;
-			std::cout << "2. Sudoku 16x16" << std::endl;
-			std::cout << "3. Sudoku 25x25" << std::endl;
-			std::cout << "Elija una opción: ";
-			std::cin >> opcionSudoku;
-
-			auto start = std::chrono::high_resolution_clock::now();
-			switch (opcionSudoku) {
-			case 1:
-				resolver9x9();
-				break;
-			case 2:
-				resolver16x16();
-				break;
-			case 3:
-				resolver25x25();
-				break;
-				// Añadir más casos para 16x16 y 25x25 según sea necesario.
-			default:
+		case 1:    // Backtracking recursivo
+		case 2:    // Paralelización por filas aleatorias
+		case 4:    // Propagación por oleadas (filas, columnas y cajas en paralelo) + backtracking
+		case 5: {  // Backtracking iterativo con checkpoints en disco
+			std::vector<std::vector<int>>* tablero = elegirTablero();
+			if (tablero == nullptr) {
 				std::cout << "Opción no válida." << std::endl;
 				continue;
 			}
-			auto end = std::chrono::high_resolution_clock::now();
-			auto duration_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-			std::cout << "Tiempo para resolver el Sudoku: " << duration_ms << " ms" << std::endl;
-
-			break;
-		}
-
-		case 2: {  // Resolver Sudoku con paralelización por filas aleatorias
-			std::cout << "\n=== Elija el tamaño del Sudoku ===" << std::endl;
-			std::cout << "1. Sudoku 9x9" << std::endl;
-			std::cout << "2. Sudoku 16x16" << std::endl;
-			std::cout << "3. Sudoku 25x25" << std::endl;
-			std::cout << "Elija una opción: ";
-			std::cin >> opcionSudoku;
 
 			auto start = std::chrono::high_resolution_clock::now();
-			switch (opcionSudoku) {
+			switch (opcionPrincipal) {
 			case 1:
-				resolver9x9p();
-
+				resolverSudoku(*tablero);
 				break;
 			case 2:
-				resolver16x16p();
-
+				resolverSudokuConHilos(*tablero);
 				break;
-			case 3:
-				resolver25x25p();
-
+			case 4:
+				resolverSudokuConOleadas(*tablero);
+				break;
+			case 5:
+				resolverSudokuConCheckpoint(*tablero);
 				break;
-			default:
-				std::cout << "Opción no válida." << std::endl;
-				continue;
 			}
 			auto end = std::chrono::high_resolution_clock::now();
 			auto duration_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
@@ -140,6 +137,47 @@ void menuPrincipal() {
 			break;
 		}
 
+		case 6: {  // Expandir la frontera en shards y resolverlos con varios procesos
+			std::vector<std::vector<int>>* tablero = elegirTablero();
+			if (tablero == nullptr) {
+				std::cout << "Opción no válida." << std::endl;
+				continue;
+			}
+			int numWorkers, profundidad;
+			std::cout << "Número de procesos worker (1-" << MAXIMO_WORKERS_LOCALES << "): ";
+			if (!leerEntero(numWorkers) || numWorkers < 1 || numWorkers > MAXIMO_WORKERS_LOCALES) {
+				std::cout << "Número de procesos no válido." << std::endl;
+				continue;
+			}
+			std::cout << "Profundidad de la frontera (casillas fijadas por shard): ";
+			if (!leerEntero(profundidad) || profundidad < 0) {
+				std::cout << "Profundidad no válida." << std::endl;
+				continue;
+			}
+
+			auto start = std::chrono::high_resolution_clock::now();
+			resolverSudokuConShards(*tablero, programa, numWorkers, profundidad);
+			auto end = std::chrono::high_resolution_clock::now();
+			auto duration_ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+			std::cout << "Tiempo para resolver el Sudoku: " << duration_ms << " ms" << std::endl;
+			break;
+		}
+
+		case 7: {  // Ediciones incrementales con validación y pistas
+			std::vector<std::vector<int>>* tablero = elegirTablero();
+			if (tablero == nullptr) {
+				std::cout << "Opción no válida." << std::endl;
+				continue;
+			}
+			ejecutarSesionInteractiva(*tablero);
+			break;
+		}
+
+		case 8: {  // Todos los backends sobre los corpus de benchmark/ con validación de soluciones
+			ejecutarBenchmark("benchmark", UMBRAL_BENCHMARK_POR_DEFECTO, false, false);
+			break;
+		}
+
 		default:
 			std::cout << "Opción no válida." << std::endl;
 			break;
@@ -149,7 +187,64 @@ void menuPrincipal() {
 	}
 }
 
-int main() {
-	menuPrincipal();
+int main(int argc, char* argv[]) {
+	std::string programa = argc > 0 ? argv[0] : "";
+
+	// Modo worker: reclama shards del directorio compartido hasta que se publique una solución
+	if (argc == 3 && std::string(argv[1]) == "--worker") {
+		ejecutarWorker(argv[2]);
+		return 0;
+	}
+
+	// Generar shards para workers de otras máquinas: --generar-shards <directorio> <archivo_tablero> <profundidad>
+	// El archivo contiene el tamaño y después una fila por línea, con 0 en las casillas vacías
+	if (argc == 5 && std::string(argv[1]) == "--generar-shards") {
+		std::vector<std::vector<int>> tablero = leerTableroInicial(argv[3]);
+		if (tablero.empty()) {
+			std::cout << "Tablero no válido: " << argv[3] << std::endl;
+			return 1;
+		}
+		char* fin = nullptr;
+		long profundidad = std::strtol(argv[4], &fin, 10);
+		if (*argv[4] == '\0' || *fin != '\0' || profundidad < 0) {
+			std::cout << "Profundidad no válida: " << argv[4] << std::endl;
+			return 1;
+		}
+		int numShards = generarShards(tablero, argv[2], static_cast<int>(std::min<long>(profundidad, INT_MAX)));
+		if (numShards < 0) return 1;
+		std::cout << "Shards generados en " << argv[2] << ": " << numShards << std::endl;
+		return 0;
+	}
+
+	// Benchmark de regresión: --benchmark [directorio] [umbral] [--tiempo]; termina con 1 si hay fallos o regresiones.
+	// Sin --tiempo solo se comparan los nodos, que no dependen de la máquina
+	if (argc >= 2 && std::string(argv[1]) == "--benchmark") {
+		std::vector<std::string> posicionales;
+		bool compararTiempo = false;
+		for (int i = 2; i < argc; i++) {
+			if (std::string(argv[i]) == "--tiempo") compararTiempo = true;
+			else posicionales.push_back(argv[i]);
+		}
+		std::string directorio = posicionales.size() >= 1 ? posicionales[0] : "benchmark";
+		double umbral = UMBRAL_BENCHMARK_POR_DEFECTO;
+		if (posicionales.size() >= 2) {
+			const char* texto = posicionales[1].c_str();
+			char* fin = nullptr;
+			umbral = std::strtod(texto, &fin);
+			if (*texto == '\0' || *fin != '\0' || !std::isfinite(umbral) || umbral <= 0.0) {
+				std::cout << "Umbral no válido: " << texto << std::endl;
+				return 1;
+			}
+		}
+		return ejecutarBenchmark(directorio, umbral, compararTiempo, false);
+	}
+
+	// Reescribe la baseline con las mediciones de esta máquina: --benchmark-baseline [directorio]
+	if (argc >= 2 && std::string(argv[1]) == "--benchmark-baseline") {
+		std::string directorio = argc >= 3 ? argv[2] : "benchmark";
+		return ejecutarBenchmark(directorio, UMBRAL_BENCHMARK_POR_DEFECTO, false, true);
+	}
+
+	menuPrincipal(programa);
 	return 0;
 }
\ No newline at end of file
@@ -9,8 +9,10 @@
 #include <omp.h>  // Para las directivas de paralelizacin con OpenMP
 #include <random> // Para generar nmeros aleatorios
 #include <iomanip> // Para formatear la salida
+#include <algorithm> // Para std::sort
 #include "sudokus.h"   // Archivo con las representaciones de tableros de Sudoku
 #include "paralelo.h"  // Archivo para la resolucin paralela del Sudoku
+#include "Secuencial.h" // Backtracking secuencial de respaldo
 
 const int NUM_HILOS = 8;
 
@@ -67,17 +69,20 @@ void gestionarCasillasPendientes(std::vector<CasillaPendiente>& pendientes, int*
 }
 
 // Resolver una fila utilizando backtracking con propagacin de restricciones
-bool resolverFilapLocal(int** localBoard, int fila, int dimension, std::vector<std::vector<std::vector<bool>>>& restricciones) {
+bool resolverFilapLocal(int** localBoard, int fila, int dimension, std::vector<std::vector<std::vector<bool>>>& restricciones,
+	unsigned long long& nodos, unsigned long long limiteNodos) {
 	for (int col = 0; col < dimension; col++) {
 		if (localBoard[fila][col] == 0) {
 			for (int num = 1; num <= dimension; num++) {
 				if (isSafeLocal(localBoard, fila, col, num, dimension) && !restricciones[fila][col][num - 1]) {
+					if (nodos >= limiteNodos) return false; // Lmite de nodos alcanzado
+					nodos++;
 					localBoard[fila][col] = num;
 
 					// Actualizar restricciones
 					restricciones[fila][col][num - 1] = true;
 
-					if (resolverFilapLocal(localBoard, fila, dimension, restricciones)) return true;
+					if (resolverFilapLocal(localBoard, fila, dimension, restricciones, nodos, limiteNodos)) return true;
 
 					// Revertir restricciones y retroceder
 					restricciones[fila][col][num - 1] = false;
@@ -111,8 +116,10 @@ void ordenarFilasPorVacias(int** board, int dimension, std::vector<int>& filasOr
 
 // Funcin para calcular el nmero de posibles soluciones por casilla en cada fila
 void ordenarFilasPorSolucionesPosibles(int** board, int dimension, std::vector<int>& filasOrdenadas) {
-	std::vector<std::pair<int, int>> filaConSoluciones;
+	std::vector<std::pair<int, int>> filaConSoluciones(dimension);
 
+	// Cada fila se cuenta de forma independiente, por lo que se reparten entre los hilos
+#pragma omp parallel for schedule(dynamic)
 	for (int i = 0; i < dimension; i++) {
 		int posibles = 0;
 		for (int j = 0; j < dimension; j++) {
@@ -126,7 +133,7 @@ void ordenarFilasPorSolucionesPosibles(int** board, int dimension, std::vector<i
 				posibles += numPosibles;  // Acumula las posibles soluciones por casilla
 			}
 		}
-		filaConSoluciones.push_back({ posibles, i });
+		filaConSoluciones[i] = { posibles, i };
 	}
 
 	// Ordenar las filas por la cantidad de soluciones posibles por casilla (de menor a mayor)
@@ -137,7 +144,8 @@ void ordenarFilasPorSolucionesPosibles(int** board, int dimension, std::vector<i
 }
 
 // Funcin principal para manejar los hilos con dos prioridades
-void manejarHilosConPrioridad(int** board, int dimension, bool* filasResueltas) {
+void manejarHilosConPrioridad(int** board, int dimension, bool* filasResueltas,
+	unsigned long long& nodos, unsigned long long limiteNodos) {
 	// Inicializar restricciones
 	std::vector<std::vector<std::vector<bool>>> restricciones(
 		dimension, std::vector<std::vector<bool>>(dimension, std::vector<bool>(dimension, false)));
@@ -170,15 +178,17 @@ void manejarHilosConPrioridad(int** board, int dimension, bool* filasResueltas)
 	ordenarFilasPorSolucionesPosibles(board, dimension, filasOrdenadasPorSoluciones);
 
 	// Resolver casillas con hilos, primero usando la prioridad de filas con menos casillas vacas
-#pragma omp parallel num_threads(NUM_HILOS)
+	unsigned long long nodosTotales = 0;
+#pragma omp parallel num_threads(NUM_HILOS) reduction(+:nodosTotales)
 	{
 		int threadID = omp_get_thread_num();
+		unsigned long long nodosHilo = 0; // Contador propio para no compartir una variable en la recursin
 		while (true) {
 			bool filaProcesada = false;
 			for (int i = 0; i < filasOrdenadas.size(); i++) {
 				int fila = filasOrdenadas[i];
 				if (!filasResueltas[fila]) {
-					if (resolverFilapLocal(localBoards[threadID], fila, dimension, restricciones)) {
+					if (resolverFilapLocal(localBoards[threadID], fila, dimension, restricciones, nodosHilo, limiteNodos)) {
 						filasResueltas[fila] = true;
 						filaProcesada = true;
 					}
@@ -189,7 +199,7 @@ void manejarHilosConPrioridad(int** board, int dimension, bool* filasResueltas)
 				for (int i = 0; i < filasOrdenadasPorSoluciones.size(); i++) {
 					int fila = filasOrdenadasPorSoluciones[i];
 					if (!filasResueltas[fila]) {
-						if (resolverFilapLocal(localBoards[threadID], fila, dimension, restricciones)) {
+						if (resolverFilapLocal(localBoards[threadID], fila, dimension, restricciones, nodosHilo, limiteNodos)) {
 							filasResueltas[fila] = true;
 							filaProcesada = true;
 						}
@@ -198,7 +208,9 @@ void manejarHilosConPrioridad(int** board, int dimension, bool* filasResueltas)
 			}
 			if (!filaProcesada) break; // Si ya no hay ms filas pendientes, se detiene
 		}
+		nodosTotales += nodosHilo;
 	}
+	nodos = nodosTotales;
 
 	// Esperar que el hilo de casillas pendientes termine su trabajo
 	hiloPendientes.join();
@@ -227,33 +239,68 @@ void manejarHilosConPrioridad(int** board, int dimension, bool* filasResueltas)
 	delete[] localBoards;
 }
 
-// Controlar la lgica de resolucin
-void controlarHilos(int** board, int dimension) {
+// Resolver por filas con hilos, validando el tablero combinado
+bool resolverConHilosValidado(int** board, int dimension, int& filasPendientes, bool& usoRespaldo,
+	unsigned long long& nodos, unsigned long long limiteNodos) {
+	int** inicial = copiarTablero(board, dimension);
 	bool* filasResueltas = new bool[dimension]();
+	nodos = 0;
 
-	bool progreso = true;
-	while (progreso) {
-		progreso = false;
+	// Repetir mientras cada ronda resuelva filas nuevas; una ronda sin avances se repetira igual
+	filasPendientes = dimension;
+	while (filasPendientes > 0 && nodos < limiteNodos) {
+		unsigned long long nodosRonda = 0;
+		manejarHilosConPrioridad(board, dimension, filasResueltas, nodosRonda, limiteNodos - nodos);
+		nodos = nodosRonda >= limiteNodos - nodos ? limiteNodos : nodos + nodosRonda;
 
-		manejarHilosConPrioridad(board, dimension, filasResueltas);
+		int pendientes = 0;
+		for (int i = 0; i < dimension; i++) {
+			if (!filasResueltas[i]) pendientes++;
+		}
+		if (pendientes == filasPendientes) break;
+		filasPendientes = pendientes;
+	}
+	delete[] filasResueltas;
 
-		int filasPendientes = 0;
+	// Cada hilo resuelve sus filas sobre su propia copia, as que al combinarlas
+	// puede quedar un nmero repetido en una columna o subcuadrcula
+	bool resuelto = filasPendientes == 0 && validarSolucion(board, inicial, dimension);
+	usoRespaldo = !resuelto;
+	if (usoRespaldo) {
 		for (int i = 0; i < dimension; i++) {
-			if (!filasResueltas[i]) filasPendientes++;
+			std::copy(inicial[i], inicial[i] + dimension, board[i]);
 		}
+		resuelto = nodos < limiteNodos && solveSudokuLimitado(board, dimension, 0, 0, nodos, limiteNodos);
+	}
+
+	freeBoard(inicial, dimension);
+	return resuelto;
+}
 
-		if (filasPendientes == 0) {
-			std::cout << "Todas las filas han sido resueltas." << std::endl;
-			printBoard(board, dimension);
-			progreso = false;
+// Controlar la lgica de resolucin
+void controlarHilos(int** board, int dimension) {
+	int filasPendientes = 0;
+	bool usoRespaldo = false;
+	unsigned long long nodos = 0;
+	bool resuelto = resolverConHilosValidado(board, dimension, filasPendientes, usoRespaldo, nodos);
+
+	if (usoRespaldo) {
+		if (filasPendientes > 0) {
+			std::cout << "Filas pendientes de resolver: " << filasPendientes << std::endl;
 		}
 		else {
-			std::cout << "Filas pendientes de resolver: " << filasPendientes << std::endl;
-			progreso = true;
+			std::cout << "El tablero combinado de los hilos no es una solucin vlida." << std::endl;
 		}
+		std::cout << "Se resuelve con backtracking secuencial." << std::endl;
 	}
 
-	delete[] filasResueltas;
+	if (resuelto) {
+		std::cout << "Todas las filas han sido resueltas." << std::endl;
+		printBoard(board, dimension);
+	}
+	else {
+		std::cout << "No se pudo resolver el Sudoku." << std::endl;
+	}
 }
 
 // Resolver el Sudoku con hilos
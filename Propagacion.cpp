@@ -0,0 +1,201 @@
+#include <iostream>
+#include <vector>
+#include <cmath>  // Para sqrt, necesario para subcuadros de mayor tamao
+#include <chrono> // Para medir el tiempo de cada oleada
+#include <atomic> // Para las propuestas de asignacin compartidas entre hilos
+#include <omp.h>  // Para las directivas de paralelizacin con OpenMP
+#include <iomanip> // Para formatear la salida
+#include "sudokus.h"     // Archivo con las representaciones de tableros de Sudoku
+#include "Secuencial.h"  // Backtracking para terminar lo que la propagacin no fija
+#include "propagacion.h"
+
+// Obtiene la casilla k-sima de una unidad: tipo 0 = fila, 1 = columna, 2 = caja
+void celdaDeUnidad(int tipo, int indice, int k, int subSize, int& fila, int& col) {
+	if (tipo == 0) {
+		fila = indice;
+		col = k;
+	}
+	else if (tipo == 1) {
+		fila = k;
+		col = indice;
+	}
+	else {
+		fila = (indice / subSize) * subSize + k / subSize;
+		col = (indice % subSize) * subSize + k % subSize;
+	}
+}
+
+MascaraCandidatos singlesOcultosDeUnidad(const std::vector<MascaraCandidatos>& candidatos, int dimension, int subSize,
+	int u, MascaraCandidatos usados, MascaraCandidatos& sinCasilla) {
+	// unaVez: nmeros que caben en alguna casilla; variasVeces: en dos o ms
+	MascaraCandidatos unaVez = 0, variasVeces = 0;
+	for (int k = 0; k < dimension; k++) {
+		int fila, col;
+		celdaDeUnidad(u / dimension, u % dimension, k, subSize, fila, col);
+		MascaraCandidatos cand = candidatos[fila * dimension + col];
+		variasVeces |= unaVez & cand;
+		unaVez |= cand;
+	}
+	MascaraCandidatos faltantes = mascaraCompleta(dimension) & ~usados;
+	sinCasilla = faltantes & ~unaVez;
+	return unaVez & ~variasVeces & faltantes;
+}
+
+// Registra una asignacin propuesta; si otra unidad ya propuso un nmero distinto hay contradiccin
+static void proponerAsignacion(std::atomic<int>& propuesta, int num, std::atomic<bool>& contradiccion) {
+	int esperado = 0;
+	if (!propuesta.compare_exchange_strong(esperado, num) && esperado != num) {
+		contradiccion = true;
+	}
+}
+
+// Propagacin por oleadas: cada oleada tiene cuatro fases separadas por la barrera implcita de omp for
+EstadisticasPropagacion propagarPorOleadas(int** board, int dimension) {
+	EstadisticasPropagacion estadisticas;
+	if (dimension > DIMENSION_MAXIMA_MASCARA) {
+		std::cout << "La propagacin por oleadas admite tableros de hasta "
+			<< DIMENSION_MAXIMA_MASCARA << "x" << DIMENSION_MAXIMA_MASCARA << "." << std::endl;
+		return estadisticas;
+	}
+
+	int subSize = static_cast<int>(std::sqrt(dimension));
+	int numUnidades = 3 * dimension;
+	int numCeldas = dimension * dimension;
+	MascaraCandidatos completa = mascaraCompleta(dimension);
+
+	// Nmeros ya colocados en cada unidad: [0, d) filas, [d, 2d) columnas, [2d, 3d) cajas
+	std::vector<MascaraCandidatos> usadosUnidad(numUnidades, 0);
+	// Candidatos de cada casilla vaca (0 para las casillas ocupadas)
+	std::vector<MascaraCandidatos> candidatos(numCeldas, 0);
+	// Segundo bfer: las asignaciones se proponen aqu y se aplican al final de la oleada
+	std::vector<std::atomic<int>> propuestas(numCeldas);
+	std::atomic<bool> contradiccion(false);
+
+	auto inicioTotal = std::chrono::high_resolution_clock::now();
+	while (true) {
+		auto inicio = std::chrono::high_resolution_clock::now();
+
+		// Fase 1: filas, columnas y cajas son independientes, se recorren en paralelo
+#pragma omp parallel for schedule(static)
+		for (int u = 0; u < numUnidades; u++) {
+			MascaraCandidatos usados = 0;
+			for (int k = 0; k < dimension; k++) {
+				int fila, col;
+				celdaDeUnidad(u / dimension, u % dimension, k, subSize, fila, col);
+				int num = board[fila][col];
+				if (num != 0) {
+					MascaraCandidatos bit = 1ULL << (num - 1);
+					if (usados & bit) contradiccion = true; // Nmero repetido en la unidad
+					usados |= bit;
+				}
+			}
+			usadosUnidad[u] = usados;
+		}
+
+		// Fase 2: candidatos por casilla y singles desnudos
+#pragma omp parallel for schedule(static)
+		for (int c = 0; c < numCeldas; c++) {
+			int fila = c / dimension, col = c % dimension;
+			propuestas[c].store(0, std::memory_order_relaxed);
+			if (board[fila][col] != 0) {
+				candidatos[c] = 0;
+				continue;
+			}
+			int caja = (fila / subSize) * subSize + col / subSize;
+			MascaraCandidatos cand = completa & ~(usadosUnidad[fila] | usadosUnidad[dimension + col] | usadosUnidad[2 * dimension + caja]);
+			candidatos[c] = cand;
+			if (cand == 0) {
+				contradiccion = true; // Casilla vaca sin ningn nmero posible
+			}
+			else if ((cand & (cand - 1)) == 0) {
+				propuestas[c].store(numeroDeBit(cand), std::memory_order_relaxed);
+			}
+		}
+
+		// Fase 3: singles ocultos, un nmero que solo cabe en una casilla de la unidad
+#pragma omp parallel for schedule(dynamic)
+		for (int u = 0; u < numUnidades; u++) {
+			MascaraCandidatos sinCasilla;
+			MascaraCandidatos unicos = singlesOcultosDeUnidad(candidatos, dimension, subSize, u, usadosUnidad[u], sinCasilla);
+			if (sinCasilla) {
+				contradiccion = true; // Un nmero que falta no cabe en ninguna casilla
+				continue;
+			}
+			if (unicos == 0) continue;
+			for (int k = 0; k < dimension; k++) {
+				int fila, col;
+				celdaDeUnidad(u / dimension, u % dimension, k, subSize, fila, col);
+				MascaraCandidatos coincidencia = candidatos[fila * dimension + col] & unicos;
+				if (coincidencia) {
+					// Dos singles ocultos en la misma casilla tambin son una contradiccin
+					if (coincidencia & (coincidencia - 1)) contradiccion = true;
+					proponerAsignacion(propuestas[fila * dimension + col], numeroDeBit(coincidencia), contradiccion);
+				}
+			}
+		}
+
+		// Fase 4: aplicar las propuestas una vez que todos los hilos han pasado la barrera
+		int asignadas = 0;
+		if (!contradiccion) {
+#pragma omp parallel for schedule(static) reduction(+:asignadas)
+			for (int c = 0; c < numCeldas; c++) {
+				int num = propuestas[c].load(std::memory_order_relaxed);
+				if (num != 0) {
+					board[c / dimension][c % dimension] = num;
+					asignadas++;
+				}
+			}
+		}
+
+		auto fin = std::chrono::high_resolution_clock::now();
+		estadisticas.oleadas++;
+		estadisticas.celdasAsignadas += asignadas;
+		estadisticas.tiempoPorOleadaMs.push_back(std::chrono::duration<double, std::milli>(fin - inicio).count());
+
+		// Punto fijo: ninguna oleada nueva puede cambiar el tablero
+		if (contradiccion || asignadas == 0) break;
+	}
+	auto finTotal = std::chrono::high_resolution_clock::now();
+
+	estadisticas.contradiccion = contradiccion;
+	estadisticas.tiempoTotalMs = std::chrono::duration<double, std::milli>(finTotal - inicioTotal).count();
+	return estadisticas;
+}
+
+// Imprime el nmero de oleadas y el tiempo de cada una
+void imprimirEstadisticasPropagacion(const EstadisticasPropagacion& estadisticas) {
+	std::cout << "Oleadas de propagacin: " << estadisticas.oleadas
+		<< " (casillas asignadas: " << estadisticas.celdasAsignadas << ")" << std::endl;
+	std::cout << std::fixed << std::setprecision(3);
+	for (size_t i = 0; i < estadisticas.tiempoPorOleadaMs.size(); i++) {
+		std::cout << "  Oleada " << (i + 1) << ": " << estadisticas.tiempoPorOleadaMs[i] << " ms" << std::endl;
+	}
+	std::cout << "Tiempo hasta la primera ramificacin: " << estadisticas.tiempoTotalMs << " ms" << std::endl;
+	std::cout.unsetf(std::ios::fixed);
+	std::cout << std::setprecision(6);
+	if (estadisticas.contradiccion) {
+		std::cout << "La propagacin encontr una contradiccin." << std::endl;
+	}
+}
+
+// Propaga por oleadas y despus resuelve con backtracking lo que quede
+void resolverSudokuConOleadas(const std::vector<std::vector<int>>& initialBoard) {
+	int size = initialBoard.size();
+	int** board = initializeBoard(initialBoard);
+
+	std::cout << "Sudoku a resolver:" << std::endl;
+	printBoard(board, size);
+
+	EstadisticasPropagacion estadisticas = propagarPorOleadas(board, size);
+	imprimirEstadisticasPropagacion(estadisticas);
+
+	if (!estadisticas.contradiccion && solveSudoku(board, size, 0, 0)) {
+		std::cout << "Sudoku resuelto:" << std::endl;
+		printBoard(board, size);
+	}
+	else {
+		std::cout << "No se pudo resolver el Sudoku." << std::endl;
+	}
+
+	freeBoard(board, size);
+}
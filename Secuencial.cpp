@@ -43,18 +43,26 @@ bool isSafe(int** board, int size, int row, int col, int num) {
 
 // Algoritmo de backtracking con memoria dinmica y poda
 bool solveSudoku(int** board, int size, int row, int col) {
+	unsigned long long nodos = 0;
+	return solveSudokuLimitado(board, size, row, col, nodos, ~0ULL);
+}
+
+// Backtracking de solveSudoku contando los nmeros colocados
+bool solveSudokuLimitado(int** board, int size, int row, int col, unsigned long long& nodos, unsigned long long limiteNodos) {
 	// Si hemos llegado al final del tablero
 	if (row == size) return true;
 	// Si la columna se sale de los lmites, pasa a la siguiente fila
-	if (col == size) return solveSudoku(board, size, row + 1, 0);
+	if (col == size) return solveSudokuLimitado(board, size, row + 1, 0, nodos, limiteNodos);
 	// Si la celda ya tiene un valor, pasa a la siguiente
-	if (board[row][col] != 0) return solveSudoku(board, size, row, col + 1);
+	if (board[row][col] != 0) return solveSudokuLimitado(board, size, row, col + 1, nodos, limiteNodos);
 
 	// Poda: verificar nmeros vlidos en la posicin actual
 	for (int num = 1; num <= size; num++) {
 		if (isSafe(board, size, row, col, num)) {
+			if (nodos >= limiteNodos) return false; // Lmite alcanzado: se abandona la bsqueda
+			nodos++;
 			board[row][col] = num; // Colocar el nmero provisionalmente
-			if (solveSudoku(board, size, row, col + 1)) return true; // Avanza
+			if (solveSudokuLimitado(board, size, row, col + 1, nodos, limiteNodos)) return true; // Avanza
 			board[row][col] = 0; // Backtrack: quitar el nmero
 		}
 	}
@@ -23,6 +23,9 @@
 // Prototipos de funciones secuenciales
 bool isSafe(int** board, int size, int row, int col, int num);
 bool solveSudoku(int** board, int size, int row, int col);
+// Igual que solveSudoku; nodos cuenta los nmeros colocados y la bsqueda se abandona
+// (devuelve false) al llegar a limiteNodos
+bool solveSudokuLimitado(int** board, int size, int row, int col, unsigned long long& nodos, unsigned long long limiteNodos);
 
 
 bool isSafe(const std::vector<std::vector<int>>& board, int row, int col, int num, int dimension);
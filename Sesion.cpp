@@ -0,0 +1,286 @@
+#include <iostream>
+#include <vector>
+#include <cmath>   // Para sqrt, necesario para subcuadros de mayor tamao
+#include <chrono>  // Para medir la latencia de cada operacin
+#include <string>
+#include "sudokus.h"  // Archivo con las representaciones de tableros de Sudoku
+#include "sesion.h"
+
+// ndices de la fila, columna y caja de una casilla dentro de conteoUnidad/usadosUnidad
+static void unidadesDeCasilla(const SesionSudoku& sesion, int celda, int unidades[3]) {
+	int fila = celda / sesion.dimension, col = celda % sesion.dimension;
+	unidades[0] = fila;
+	unidades[1] = sesion.dimension + col;
+	unidades[2] = 2 * sesion.dimension + (fila / sesion.subSize) * sesion.subSize + col / sesion.subSize;
+}
+
+static void sumarAparicion(SesionSudoku& sesion, int unidad, int num) {
+	int& cuenta = sesion.conteoUnidad[unidad * (sesion.dimension + 1) + num];
+	if (cuenta > 0) sesion.conflictos++;
+	cuenta++;
+	sesion.usadosUnidad[unidad] |= 1ULL << (num - 1);
+}
+
+static void restarAparicion(SesionSudoku& sesion, int unidad, int num) {
+	int& cuenta = sesion.conteoUnidad[unidad * (sesion.dimension + 1) + num];
+	cuenta--;
+	if (cuenta > 0) sesion.conflictos--;
+	else sesion.usadosUnidad[unidad] &= ~(1ULL << (num - 1));
+}
+
+bool iniciarSesion(SesionSudoku& sesion, const std::vector<std::vector<int>>& initialBoard) {
+	int dimension = initialBoard.size();
+	int subSize = static_cast<int>(std::sqrt(dimension));
+	if (dimension == 0 || dimension > DIMENSION_MAXIMA_MASCARA || subSize * subSize != dimension) return false;
+
+	sesion = SesionSudoku();
+	sesion.dimension = dimension;
+	sesion.subSize = subSize;
+	sesion.celdas.assign(dimension * dimension, 0);
+	sesion.conteoUnidad.assign(3 * dimension * (dimension + 1), 0);
+	sesion.usadosUnidad.assign(3 * dimension, 0);
+
+	for (int i = 0; i < dimension; i++) {
+		for (int j = 0; j < dimension; j++) {
+			if (initialBoard[i][j] != 0 && !colocarNumero(sesion, i, j, initialBoard[i][j])) return false;
+		}
+	}
+	return true;
+}
+
+bool colocarNumero(SesionSudoku& sesion, int fila, int col, int num) {
+	if (fila < 0 || fila >= sesion.dimension || col < 0 || col >= sesion.dimension) return false;
+	if (num < 1 || num > sesion.dimension) return false;
+
+	int celda = fila * sesion.dimension + col;
+	if (sesion.celdas[celda] == num) return true;
+	if (sesion.celdas[celda] != 0) borrarNumero(sesion, fila, col);
+
+	int unidades[3];
+	unidadesDeCasilla(sesion, celda, unidades);
+	for (int u : unidades) sumarAparicion(sesion, u, num);
+	sesion.celdas[celda] = num;
+
+	if (!sesion.solucionCacheada.empty() && sesion.solucionCacheada[celda] != num) sesion.discrepancias++;
+	// Colocar un nmero solo aade restricciones: si no haba solucin, sigue sin haberla
+	sesion.version++;
+	return true;
+}
+
+bool borrarNumero(SesionSudoku& sesion, int fila, int col) {
+	if (fila < 0 || fila >= sesion.dimension || col < 0 || col >= sesion.dimension) return false;
+
+	int celda = fila * sesion.dimension + col;
+	int num = sesion.celdas[celda];
+	if (num == 0) return true;
+
+	int unidades[3];
+	unidadesDeCasilla(sesion, celda, unidades);
+	for (int u : unidades) restarAparicion(sesion, u, num);
+	sesion.celdas[celda] = 0;
+
+	if (!sesion.solucionCacheada.empty() && sesion.solucionCacheada[celda] != num) sesion.discrepancias--;
+	sesion.irresolubleCacheado = false;
+	sesion.version++;
+	return true;
+}
+
+bool esValida(const SesionSudoku& sesion) {
+	return sesion.conflictos == 0;
+}
+
+MascaraCandidatos candidatosCasilla(const SesionSudoku& sesion, int fila, int col) {
+	int celda = fila * sesion.dimension + col;
+	if (sesion.celdas[celda] != 0) return 0;
+	int unidades[3];
+	unidadesDeCasilla(sesion, celda, unidades);
+	return mascaraCompleta(sesion.dimension)
+		& ~(sesion.usadosUnidad[unidades[0]] | sesion.usadosUnidad[unidades[1]] | sesion.usadosUnidad[unidades[2]]);
+}
+
+// Busca la siguiente pista sin usar la cach
+static Pista calcularPista(const SesionSudoku& sesion) {
+	Pista pista;
+	if (sesion.conflictos > 0) return pista;
+
+	int dimension = sesion.dimension;
+	int numCeldas = dimension * dimension;
+	std::vector<MascaraCandidatos> candidatos(numCeldas, 0);
+
+	// Singles desnudos: una casilla vaca con un nico candidato
+	for (int c = 0; c < numCeldas; c++) {
+		if (sesion.celdas[c] != 0) continue;
+		MascaraCandidatos cand = candidatosCasilla(sesion, c / dimension, c % dimension);
+		if (cand == 0) return pista; // Casilla sin candidatos: no hay casillas forzadas
+		candidatos[c] = cand;
+		if ((cand & (cand - 1)) == 0) {
+			pista.tipo = PISTA_SINGLE_DESNUDO;
+			pista.fila = c / dimension;
+			pista.columna = c % dimension;
+			pista.num = numeroDeBit(cand);
+			return pista;
+		}
+	}
+
+	// Singles ocultos: un nmero que falta en la unidad y solo cabe en una de sus casillas
+	for (int u = 0; u < 3 * dimension; u++) {
+		MascaraCandidatos sinCasilla;
+		MascaraCandidatos unicos = singlesOcultosDeUnidad(candidatos, dimension, sesion.subSize, u, sesion.usadosUnidad[u], sinCasilla);
+		if (unicos == 0) continue;
+		for (int k = 0; k < dimension; k++) {
+			int fila, col;
+			celdaDeUnidad(u / dimension, u % dimension, k, sesion.subSize, fila, col);
+			MascaraCandidatos coincidencia = candidatos[fila * dimension + col] & unicos;
+			if (coincidencia) {
+				pista.tipo = PISTA_SINGLE_OCULTO;
+				pista.fila = fila;
+				pista.columna = col;
+				pista.num = numeroDeBit(coincidencia);
+				return pista;
+			}
+		}
+	}
+	return pista;
+}
+
+Pista siguientePista(SesionSudoku& sesion) {
+	if (sesion.versionPista != sesion.version) {
+		sesion.pistaCacheada = calcularPista(sesion);
+		sesion.versionPista = sesion.version;
+	}
+	return sesion.pistaCacheada;
+}
+
+// Backtracking con mscaras eligiendo la casilla con menos candidatos
+static bool buscarSolucion(const SesionSudoku& sesion, std::vector<int>& celdas,
+	std::vector<MascaraCandidatos>& usados, unsigned long long& nodos) {
+	int dimension = sesion.dimension;
+	int numCeldas = dimension * dimension;
+	MascaraCandidatos completa = mascaraCompleta(dimension);
+
+	int mejor = -1, mejorCuenta = dimension + 1;
+	MascaraCandidatos mejorCandidatos = 0;
+	int unidades[3];
+	for (int c = 0; c < numCeldas; c++) {
+		if (celdas[c] != 0) continue;
+		unidadesDeCasilla(sesion, c, unidades);
+		MascaraCandidatos cand = completa & ~(usados[unidades[0]] | usados[unidades[1]] | usados[unidades[2]]);
+		int cuenta = contarBits(cand);
+		if (cuenta == 0) return false;
+		if (cuenta < mejorCuenta) {
+			mejor = c;
+			mejorCuenta = cuenta;
+			mejorCandidatos = cand;
+			if (cuenta == 1) break;
+		}
+	}
+	if (mejor == -1) return true; // No quedan casillas vacas
+
+	unidadesDeCasilla(sesion, mejor, unidades);
+	while (mejorCandidatos) {
+		MascaraCandidatos bit = mejorCandidatos & (0 - mejorCandidatos);
+		mejorCandidatos &= mejorCandidatos - 1;
+
+		celdas[mejor] = numeroDeBit(bit);
+		for (int u : unidades) usados[u] |= bit;
+		nodos++;
+		if (buscarSolucion(sesion, celdas, usados, nodos)) return true;
+		for (int u : unidades) usados[u] &= ~bit; // Backtrack
+	}
+	celdas[mejor] = 0;
+	return false;
+}
+
+bool sigueResoluble(SesionSudoku& sesion) {
+	if (sesion.conflictos > 0 || sesion.irresolubleCacheado) return false;
+	// La ltima solucin sigue siendo vlida si coincide con todas las casillas colocadas
+	if (!sesion.solucionCacheada.empty() && sesion.discrepancias == 0) return true;
+
+	std::vector<int> celdas = sesion.celdas;
+	std::vector<MascaraCandidatos> usados = sesion.usadosUnidad;
+	unsigned long long nodos = 0;
+	bool resoluble = buscarSolucion(sesion, celdas, usados, nodos);
+	sesion.nodosBusqueda = nodos;
+
+	if (resoluble) {
+		sesion.solucionCacheada = celdas;
+		sesion.discrepancias = 0;
+	}
+	else {
+		sesion.irresolubleCacheado = true;
+	}
+	return resoluble;
+}
+
+// Imprime el tablero de la sesin con el mismo formato que printBoard
+static void imprimirSesion(const SesionSudoku& sesion) {
+	std::vector<std::vector<int>> tablero(sesion.dimension, std::vector<int>(sesion.dimension));
+	for (int c = 0; c < sesion.dimension * sesion.dimension; c++) {
+		tablero[c / sesion.dimension][c % sesion.dimension] = sesion.celdas[c];
+	}
+	int** board = initializeBoard(tablero);
+	printBoard(board, sesion.dimension);
+	freeBoard(board, sesion.dimension);
+}
+
+void ejecutarSesionInteractiva(const std::vector<std::vector<int>>& initialBoard) {
+	SesionSudoku sesion;
+	if (!iniciarSesion(sesion, initialBoard)) {
+		std::cout << "No se pudo iniciar la sesin con este tablero." << std::endl;
+		return;
+	}
+
+	std::cout << "Comandos (filas y columnas desde 1):" << std::endl;
+	std::cout << "  c fila col num  colocar un nmero" << std::endl;
+	std::cout << "  b fila col      borrar una casilla" << std::endl;
+	std::cout << "  p               siguiente casilla forzada" << std::endl;
+	std::cout << "  r               comprobar si sigue teniendo solucin" << std::endl;
+	std::cout << "  t               mostrar el tablero" << std::endl;
+	std::cout << "  s               salir" << std::endl;
+
+	std::string comando;
+	while (std::cout << "> " && std::cin >> comando && comando != "s") {
+		auto inicio = std::chrono::high_resolution_clock::now();
+		if (comando == "c") {
+			int fila, col, num;
+			if (!leerEntero(fila) || !leerEntero(col) || !leerEntero(num)) {
+				std::cout << "Comando no vlido." << std::endl;
+				continue;
+			}
+			if (!colocarNumero(sesion, fila - 1, col - 1, num)) std::cout << "Casilla o nmero fuera de rango." << std::endl;
+			else std::cout << (esValida(sesion) ? "Vlido." : "Hay nmeros repetidos.") << std::endl;
+		}
+		else if (comando == "b") {
+			int fila, col;
+			if (!leerEntero(fila) || !leerEntero(col)) {
+				std::cout << "Comando no vlido." << std::endl;
+				continue;
+			}
+			if (!borrarNumero(sesion, fila - 1, col - 1)) std::cout << "Casilla fuera de rango." << std::endl;
+			else std::cout << (esValida(sesion) ? "Vlido." : "Hay nmeros repetidos.") << std::endl;
+		}
+		else if (comando == "p") {
+			Pista pista = siguientePista(sesion);
+			if (pista.tipo == PISTA_NINGUNA) {
+				std::cout << "No hay casillas forzadas." << std::endl;
+			}
+			else {
+				std::cout << (pista.tipo == PISTA_SINGLE_DESNUDO ? "Single desnudo" : "Single oculto")
+					<< ": fila " << pista.fila + 1 << ", columna " << pista.columna + 1 << " -> " << pista.num << std::endl;
+			}
+		}
+		else if (comando == "r") {
+			std::cout << (sigueResoluble(sesion) ? "Sigue teniendo solucin." : "Ya no tiene solucin.") << std::endl;
+		}
+		else if (comando == "t") {
+			imprimirSesion(sesion);
+			continue;
+		}
+		else {
+			std::cout << "Comando no vlido." << std::endl;
+			continue;
+		}
+		auto fin = std::chrono::high_resolution_clock::now();
+		std::cout << "(" << std::chrono::duration_cast<std::chrono::microseconds>(fin - inicio).count() << " us)" << std::endl;
+	}
+}
@@ -0,0 +1,316 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <fstream>     // Para leer y escribir los shards
+#include <sstream>
+#include <iomanip>     // Para numerar los shards con ceros a la izquierda
+#include <algorithm>   // Para std::sort
+#include <filesystem>  // Para listar, reclamar y publicar archivos del directorio compartido
+#include <random>      // Para el identificador de cada worker
+#include <thread>      // Un hilo por proceso lanzado
+#include <cstdlib>     // Para std::system
+#include <cmath>       // Para sqrt, para comprobar que el tamao es un cuadrado perfecto
+#include "sudokus.h"     // Archivo con las representaciones de tableros de Sudoku
+#include "Secuencial.h"  // isSafe sobre int**
+#include "checkpoint.h"  // Backtracking iterativo con condicin de parada
+#include "shards.h"
+
+namespace fs = std::filesystem;
+
+// Ruta del shard nmero indice
+static fs::path rutaShard(const std::string& directorio, int indice) {
+	std::ostringstream nombre;
+	nombre << "shard_" << std::setw(6) << std::setfill('0') << indice << ".txt";
+	return fs::path(directorio) / nombre.str();
+}
+
+// Escribe un tablero en texto (huella del trabajo, tamao y despus una fila por lnea) de forma atmica
+static bool escribirTablero(const fs::path& ruta, unsigned long long huella, int** board, int size,
+	const std::string& sufijoTemporal) {
+	fs::path temporal = ruta;
+	temporal += ".tmp" + sufijoTemporal;
+	{
+		std::ofstream salida(temporal.string(), std::ios::trunc);
+		if (!salida) return false;
+		salida << std::hex << huella << std::dec << "\n";
+		salida << size << "\n";
+		for (int i = 0; i < size; i++) {
+			for (int j = 0; j < size; j++) {
+				salida << board[i][j] << (j != size - 1 ? " " : "\n");
+			}
+		}
+		if (!salida) return false;
+	}
+	std::error_code ec;
+	fs::rename(temporal, ruta, ec);
+	return !ec;
+}
+
+// Lee el tamao y las filas de un tablero (vaco si el tamao no es un cuadrado perfecto
+// o algn nmero est fuera de 0..tamao)
+static std::vector<std::vector<int>> leerFilas(std::istream& entrada) {
+	int size = 0;
+	if (!(entrada >> size) || size <= 0) return {};
+	int subSize = static_cast<int>(std::sqrt(size));
+	if (subSize * subSize != size) return {};
+	std::vector<std::vector<int>> tablero(size, std::vector<int>(size, 0));
+	for (int i = 0; i < size; i++) {
+		for (int j = 0; j < size; j++) {
+			if (!(entrada >> tablero[i][j]) || tablero[i][j] < 0 || tablero[i][j] > size) return {};
+		}
+	}
+	return tablero;
+}
+
+// Lee un tablero escrito por escribirTablero y la huella de su trabajo (vaco si el archivo no es vlido)
+static std::vector<std::vector<int>> leerTablero(const fs::path& ruta, unsigned long long& huella) {
+	std::ifstream entrada(ruta.string());
+	if (!(entrada >> std::hex >> huella >> std::dec)) return {};
+	return leerFilas(entrada);
+}
+
+std::vector<std::vector<int>> leerTableroInicial(const std::string& ruta) {
+	std::ifstream entrada(ruta);
+	return leerFilas(entrada);
+}
+
+// Recorre las primeras casillas vacas en el orden de solveSudoku y escribe cada hoja como shard.
+// Devuelve false en cuanto falla una escritura, porque esa rama se perdera sin aviso
+static bool expandirFrontera(int** board, int size, const std::vector<int>& vacias, int nivel,
+	int profundidadFrontera, const std::string& directorio, unsigned long long huella, int& contador) {
+	if (nivel == profundidadFrontera) {
+		if (!escribirTablero(rutaShard(directorio, contador), huella, board, size, "")) return false;
+		contador++;
+		return true;
+	}
+	int fila = vacias[nivel] / size, col = vacias[nivel] % size;
+	for (int num = 1; num <= size; num++) {
+		if (isSafe(board, size, fila, col, num)) {
+			board[fila][col] = num;
+			bool escrito = expandirFrontera(board, size, vacias, nivel + 1, profundidadFrontera, directorio, huella, contador);
+			board[fila][col] = 0; // Backtrack para generar la siguiente rama
+			if (!escrito) return false;
+		}
+	}
+	return true;
+}
+
+// Huella guardada en el archivo de trabajo del directorio (0 si no existe)
+static unsigned long long leerHuellaTrabajo(const std::string& directorio) {
+	std::ifstream entrada((fs::path(directorio) / ARCHIVO_TRABAJO).string());
+	unsigned long long huella = 0;
+	if (!(entrada >> std::hex >> huella)) return 0;
+	return huella;
+}
+
+// El marcador existe y lo public un worker del trabajo indicado
+static bool marcadorDelTrabajo(const fs::path& marcador, unsigned long long huella) {
+	std::ifstream entrada(marcador.string());
+	unsigned long long huellaMarcador = 0;
+	return entrada >> std::hex >> huellaMarcador && huellaMarcador == huella;
+}
+
+int generarShards(const std::vector<std::vector<int>>& initialBoard, const std::string& directorio, int profundidadFrontera) {
+	// Un directorio con archivos de otra ejecucin mezclara shards, marcadores y soluciones
+	std::error_code ec;
+	if (fs::exists(directorio, ec) && !fs::is_empty(directorio, ec)) {
+		std::cout << "El directorio " << directorio << " no est vaco; no se generan shards." << std::endl;
+		return -1;
+	}
+
+	int size = initialBoard.size();
+	int** board = initializeBoard(initialBoard);
+	unsigned long long huella = huellaTablero(board, size);
+
+	std::vector<int> vacias;
+	for (int i = 0; i < size; i++) {
+		for (int j = 0; j < size; j++) {
+			if (board[i][j] == 0) vacias.push_back(i * size + j);
+		}
+	}
+	if (profundidadFrontera > static_cast<int>(vacias.size())) profundidadFrontera = vacias.size();
+	if (profundidadFrontera < 0) profundidadFrontera = 0;
+
+	fs::create_directories(directorio, ec);
+	if (ec || !fs::is_directory(directorio, ec)) {
+		std::cout << "No se pudo crear el directorio " << directorio << "." << std::endl;
+		freeBoard(board, size);
+		return -1;
+	}
+	std::ofstream trabajo((fs::path(directorio) / ARCHIVO_TRABAJO).string());
+	trabajo << std::hex << huella << std::endl;
+	if (!trabajo) {
+		std::cout << "No se pudo escribir " << ARCHIVO_TRABAJO << " en " << directorio << "." << std::endl;
+		freeBoard(board, size);
+		return -1;
+	}
+	trabajo.close();
+
+	int contador = 0;
+	bool escrito = expandirFrontera(board, size, vacias, 0, profundidadFrontera, directorio, huella, contador);
+	freeBoard(board, size);
+	if (!escrito) {
+		std::cout << "No se pudo escribir el shard " << contador << " en " << directorio << "." << std::endl;
+		return -1;
+	}
+	return contador;
+}
+
+// Shards pendientes (sin reclamar), ordenados para explorarlos en el orden de la bsqueda
+static std::vector<fs::path> listarShardsPendientes(const std::string& directorio) {
+	std::vector<fs::path> pendientes;
+	std::error_code ec;
+	for (const auto& entrada : fs::directory_iterator(directorio, ec)) {
+		std::string nombre = entrada.path().filename().string();
+		if (nombre.rfind("shard_", 0) == 0 && entrada.path().extension() == ".txt") {
+			pendientes.push_back(entrada.path());
+		}
+	}
+	std::sort(pendientes.begin(), pendientes.end());
+	return pendientes;
+}
+
+// Identificador aleatorio del worker, nico entre procesos y mquinas
+static std::string generarIdWorker() {
+	std::random_device rd;
+	std::ostringstream id;
+	id << std::hex << rd() << rd();
+	return id.str();
+}
+
+bool ejecutarWorker(const std::string& directorio) {
+	std::string idWorker = generarIdWorker();
+	unsigned long long huella = leerHuellaTrabajo(directorio);
+	if (huella == 0) {
+		std::cout << "[worker " << idWorker << "] " << directorio << " no contiene " << ARCHIVO_TRABAJO << std::endl;
+		return false;
+	}
+	// Un marcador de otro trabajo no detiene la bsqueda
+	fs::path marcador = fs::path(directorio) / MARCADOR_SOLUCION;
+	auto detener = [&marcador, huella]() {
+		return marcadorDelTrabajo(marcador, huella);
+	};
+
+	int explorados = 0;
+	while (!detener()) {
+		std::vector<fs::path> pendientes = listarShardsPendientes(directorio);
+		bool reclamado = false;
+
+		for (const auto& shard : pendientes) {
+			if (detener()) break;
+
+			// Reclamar el shard renombrndolo; si falla, otro worker se adelant
+			fs::path reclamo = shard;
+			reclamo += "." + idWorker;
+			std::error_code ec;
+			fs::rename(shard, reclamo, ec);
+			if (ec) continue;
+			reclamado = true;
+
+			unsigned long long huellaShard = 0;
+			std::vector<std::vector<int>> tablero = leerTablero(reclamo, huellaShard);
+			if (tablero.empty()) {
+				// Shard ilegible: se aparta para que no quede reclamado para siempre
+				fs::path erroneo = shard;
+				erroneo.replace_extension(".error");
+				fs::rename(reclamo, erroneo, ec);
+				std::cout << "[worker " << idWorker << "] " << shard.filename().string()
+					<< ": no se pudo leer el tablero, se aparta como " << erroneo.filename().string() << std::endl;
+				continue;
+			}
+			if (huellaShard != huella) {
+				// Shard de otro trabajo: se aparta sin explorarlo
+				fs::path ajeno = shard;
+				ajeno.replace_extension(".ajeno");
+				fs::rename(reclamo, ajeno, ec);
+				std::cout << "[worker " << idWorker << "] " << shard.filename().string()
+					<< ": pertenece a otro trabajo, se ignora" << std::endl;
+				continue;
+			}
+			int size = tablero.size();
+			int** board = initializeBoard(tablero);
+
+			EstadoBusqueda estado;
+			bool resuelto = solveSudokuConCheckpoint(board, size, "", INTERVALO_CHECKPOINT_NODOS, estado, detener);
+			explorados++;
+
+			if (resuelto) {
+				// Publicar la solucin antes del marcador, para que quien vea el marcador pueda leerla
+				escribirTablero(fs::path(directorio) / ARCHIVO_SOLUCION, huella, board, size, "." + idWorker);
+				std::ofstream(marcador.string()) << std::hex << huella << std::dec << " " << idWorker << " "
+					<< shard.filename().string() << std::endl;
+				std::cout << "[worker " << idWorker << "] " << shard.filename().string()
+					<< ": solucin encontrada (nodos " << estado.nodos << ")" << std::endl;
+				freeBoard(board, size);
+				return true;
+			}
+			if (!estado.detenida) {
+				fs::path hecho = shard;
+				hecho.replace_extension(".hecho");
+				fs::rename(reclamo, hecho, ec);
+				std::cout << "[worker " << idWorker << "] " << shard.filename().string()
+					<< ": sin solucin (nodos " << estado.nodos << ")" << std::endl;
+			}
+			freeBoard(board, size);
+		}
+
+		// Sin shards pendientes o todos reclamados por otros workers
+		if (!reclamado) break;
+	}
+
+	std::cout << "[worker " << idWorker << "] terminado, shards explorados: " << explorados << std::endl;
+	return false;
+}
+
+void lanzarWorkersLocales(const std::string& programa, const std::string& directorio, int numWorkers) {
+	std::string comando = "\"" + programa + "\" --worker \"" + directorio + "\"";
+#ifdef _WIN32
+	// cmd.exe quita las comillas exteriores si la orden empieza por comillas
+	comando = "\"" + comando + "\"";
+#endif
+
+	std::vector<std::thread> procesos;
+	for (int i = 0; i < numWorkers; i++) {
+		procesos.emplace_back([comando]() { std::system(comando.c_str()); });
+	}
+	for (auto& proceso : procesos) {
+		proceso.join();
+	}
+}
+
+std::vector<std::vector<int>> leerSolucionPublicada(const std::string& directorio, unsigned long long huella) {
+	unsigned long long huellaSolucion = 0;
+	std::vector<std::vector<int>> solucion = leerTablero(fs::path(directorio) / ARCHIVO_SOLUCION, huellaSolucion);
+	if (huellaSolucion != huella) return {};
+	return solucion;
+}
+
+void resolverSudokuConShards(const std::vector<std::vector<int>>& initialBoard, const std::string& programa,
+	int numWorkers, int profundidadFrontera) {
+	int size = initialBoard.size();
+	std::string directorio = "shards_" + std::to_string(size) + "x" + std::to_string(size);
+
+	// Empezar con el directorio limpio para no mezclar shards ni marcadores de otra ejecucin
+	std::error_code ec;
+	fs::remove_all(directorio, ec);
+
+	int numShards = generarShards(initialBoard, directorio, profundidadFrontera);
+	if (numShards < 0) return;
+	std::cout << "Shards generados en " << directorio << ": " << numShards << std::endl;
+	if (numShards == 0) {
+		std::cout << "No se pudo resolver el Sudoku." << std::endl;
+		return;
+	}
+
+	lanzarWorkersLocales(programa, directorio, numWorkers);
+
+	std::vector<std::vector<int>> solucion = leerSolucionPublicada(directorio, leerHuellaTrabajo(directorio));
+	if (solucion.empty()) {
+		std::cout << "No se pudo resolver el Sudoku." << std::endl;
+		return;
+	}
+	int** board = initializeBoard(solucion);
+	std::cout << "Sudoku resuelto:" << std::endl;
+	printBoard(board, size);
+	freeBoard(board, size);
+}
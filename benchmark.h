@@ -0,0 +1,37 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <vector>
+#include <iostream>
+#include <string>
+
+// Benchmark de regresin: ejecuta cada backend sobre los corpus de benchmark/corpus,
+// valida cada solucin y compara los nodos explorados con benchmark/baseline.txt.
+// Los nodos no dependen de la mquina y son la comprobacin obligatoria; el tiempo solo se
+// compara si se pide, porque la baseline se mide en la mquina de referencia.
+// Los nodos de paralelo dependen del orden de los hilos: se miden pero no se comparan, y
+// ese backend solo falla si da una solucin incorrecta o alcanza LIMITE_NODOS_BENCHMARK.
+//
+// Los corpus se llaman <d>x<d>_<nivel>.txt con nivel facil, dificil, patologico o irresoluble.
+// Cada Sudoku es un bloque de filas de nmeros separados por espacios; los bloques se separan
+// con una lnea en blanco y las lneas que empiezan por '#' son comentarios.
+
+// Factor sobre la baseline a partir del cual una medicin se considera regresin
+const double UMBRAL_BENCHMARK_POR_DEFECTO = 1.5;
+
+// Margen fijo de tiempo para que el ruido en niveles de pocos milisegundos no cuente como regresin
+const double MARGEN_TIEMPO_BENCHMARK_MS = 5.0;
+
+// Lmite de nodos por Sudoku para los backends de backtracking; alcanzarlo cuenta como fallo
+const unsigned long long LIMITE_NODOS_BENCHMARK = 200000000ULL;
+
+// Lee los Sudokus de dimension x dimension de un archivo de corpus (vaco si no existe).
+// Se ignoran los bloques de otro tamao o con nmeros fuera de 0..dimension
+std::vector<std::vector<std::vector<int>>> cargarCorpus(const std::string& ruta, int dimension);
+
+// Ejecuta el benchmark y devuelve 0 si todo es correcto y no hay regresiones, 1 en otro caso.
+// Con compararTiempo tambin cuenta como regresin superar el tiempo de la baseline.
+// Con actualizarBaseline se reescribe la baseline con las mediciones actuales.
+int ejecutarBenchmark(const std::string& directorio, double umbral, bool compararTiempo, bool actualizarBaseline);
+
+#endif // BENCHMARK_H
@@ -0,0 +1,71 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <vector>
+#include <iostream>
+#include <string>
+#include <thread>             // Hilo que escribe los checkpoints en segundo plano
+#include <mutex>
+#include <condition_variable>
+#include <functional>         // Condicin de parada opcional de la bsqueda
+
+// Cada cuntos nodos explorados se guarda el estado de la bsqueda
+const unsigned long long INTERVALO_CHECKPOINT_NODOS = 1ULL << 20;
+
+// Cada cuntos nodos se consulta la condicin de parada
+const unsigned long long INTERVALO_DETENCION_NODOS = 1ULL << 16;
+
+// Estado de la bsqueda iterativa. El recorrido es el mismo que el de solveSudoku
+// (casillas vacas por filas y nmeros de 1 a size), por lo que el rastro de valores
+// basta para describir la frontera: en cada nivel quedan por explorar los nmeros
+// mayores que el valor colocado.
+struct EstadoBusqueda {
+	std::vector<int> vacias;           // Casillas vacas del tablero inicial (fila * size + col)
+	std::vector<int> valores;          // Nmero colocado en cada nivel del rastro (0 = ninguno)
+	int profundidad = 0;               // Niveles del rastro con un nmero colocado
+	unsigned long long nodos = 0;      // Nmeros colocados durante la bsqueda
+	unsigned long long retrocesos = 0; // Niveles abandonados sin encontrar nmero vlido
+	bool detenida = false;             // La condicin de parada interrumpi la bsqueda
+};
+
+// Escritor asncrono: la bsqueda deja la ltima instantnea y el hilo la escribe en disco
+struct EscritorCheckpoint {
+	std::string ruta;
+	std::thread hilo;
+	std::mutex mtx;
+	std::condition_variable cv;
+	std::vector<unsigned char> pendiente; // Instantnea ms reciente an sin escribir
+	bool hayPendiente = false;
+	bool terminar = false;
+};
+
+// Arranca el hilo escritor para la ruta indicada
+void iniciarEscritor(EscritorCheckpoint& escritor, const std::string& ruta);
+
+// Entrega una instantnea al escritor; si haba otra sin escribir se descarta la anterior
+void programarCheckpoint(EscritorCheckpoint& escritor, std::vector<unsigned char>&& datos);
+
+// Escribe la instantnea pendiente (si la hay) y termina el hilo escritor
+void detenerEscritor(EscritorCheckpoint& escritor);
+
+// Serializa el estado en el formato binario del checkpoint
+std::vector<unsigned char> serializarEstado(const EstadoBusqueda& estado, int size, unsigned long long huella);
+
+// Lee un checkpoint y restaura el rastro; falla si no corresponde al tablero indicado
+bool cargarCheckpoint(const std::string& ruta, int size, unsigned long long huella, EstadoBusqueda& estado);
+
+// Huella FNV-1a del tablero inicial, para no reanudar con un checkpoint de otro Sudoku
+unsigned long long huellaTablero(int** board, int size);
+
+// Backtracking iterativo equivalente a solveSudoku que guarda checkpoints peridicos
+// y, si existe uno vlido en rutaCheckpoint, contina desde l. Si detener devuelve true
+// la bsqueda se interrumpe y el checkpoint queda guardado para reanudarla.
+// Con intervaloNodos 0 solo se guarda el checkpoint al detenerse.
+bool solveSudokuConCheckpoint(int** board, int size, const std::string& rutaCheckpoint,
+	unsigned long long intervaloNodos, EstadoBusqueda& estado,
+	const std::function<bool()>& detener = nullptr);
+
+// Resuelve el Sudoku con checkpoints en checkpoint_<size>x<size>.bin
+void resolverSudokuConCheckpoint(const std::vector<std::vector<int>>& initialBoard);
+
+#endif // CHECKPOINT_H
@@ -25,8 +25,10 @@ bool isSafeLocal(int** board, int row, int col, int num, int dimension);
 // Gestiona las casillas pendientes mientras otros hilos resuelven el Sudoku
 //void gestionarCasillasPendientes(std::vector<CasillaPendiente>& pendientes, int** board, int dimension, bool& progreso);
 
-// Resuelve una fila utilizando backtracking con propagacin de restricciones
-bool resolverFilapLocal(int** localBoard, int fila, int dimension, std::vector<std::vector<std::vector<bool>>>& restricciones);
+// Resuelve una fila utilizando backtracking con propagacin de restricciones.
+// nodos cuenta los nmeros colocados; al llegar a limiteNodos la fila se abandona
+bool resolverFilapLocal(int** localBoard, int fila, int dimension, std::vector<std::vector<std::vector<bool>>>& restricciones,
+	unsigned long long& nodos, unsigned long long limiteNodos);
 
 // Calcula la cantidad de casillas vacas en cada fila
 void ordenarFilasPorVacias(int** board, int dimension, std::vector<int>& filasOrdenadas);
@@ -34,8 +36,16 @@ void ordenarFilasPorVacias(int** board, int dimension, std::vector<int>& filasOr
 // Calcula el nmero de posibles soluciones por casilla en cada fila
 void ordenarFilasPorSolucionesPosibles(int** board, int dimension, std::vector<int>& filasOrdenadas);
 
-// Funcin principal para manejar los hilos con prioridades
-void manejarHilosConPrioridad(int** board, int dimension, bool* filasResueltas);
+// Funcin principal para manejar los hilos con prioridades. Cada hilo puede colocar
+// hasta limiteNodos nmeros; nodos recibe la suma de todos los hilos
+void manejarHilosConPrioridad(int** board, int dimension, bool* filasResueltas,
+	unsigned long long& nodos, unsigned long long limiteNodos);
+
+// Resuelve por filas con hilos y valida el tablero combinado; si no es una solucin vlida
+// vuelve al tablero inicial y lo resuelve con backtracking secuencial.
+// nodos cuenta los nmeros colocados en total; al llegar a limiteNodos se deja de buscar
+bool resolverConHilosValidado(int** board, int dimension, int& filasPendientes, bool& usoRespaldo,
+	unsigned long long& nodos, unsigned long long limiteNodos = ~0ULL);
 
 // Controla la lgica de resolucin
 void controlarHilos(int** board, int dimension);
@@ -0,0 +1,71 @@
+#ifndef PROPAGACION_H
+#define PROPAGACION_H
+
+#include <vector>
+#include <iostream>
+#include <cmath>  // Para sqrt, necesario para subcuadros de mayor tamao
+#include <chrono> // Para medir el tiempo de cada oleada
+#include <atomic> // Para las propuestas de asignacin compartidas entre hilos
+#include <omp.h>
+
+// Mscara de candidatos de una casilla: el bit (num - 1) indica que num es posible.
+// Con 64 bits se cubren tableros de hasta 64x64 (9x9, 16x16, 25x25, 36x36 y 49x49).
+typedef unsigned long long MascaraCandidatos;
+
+const int DIMENSION_MAXIMA_MASCARA = 64;
+
+// Cuenta los bits activos de una mscara (cantidad de candidatos)
+inline int contarBits(MascaraCandidatos mascara) {
+	int cuenta = 0;
+	while (mascara) {
+		mascara &= mascara - 1;
+		cuenta++;
+	}
+	return cuenta;
+}
+
+// Devuelve el nmero (1..dimension) asociado al bit ms bajo de la mscara
+inline int numeroDeBit(MascaraCandidatos mascara) {
+	int num = 1;
+	while (!(mascara & 1ULL)) {
+		mascara >>= 1;
+		num++;
+	}
+	return num;
+}
+
+// Mscara con los bits 0..dimension-1 activos
+inline MascaraCandidatos mascaraCompleta(int dimension) {
+	return dimension >= 64 ? ~0ULL : ((1ULL << dimension) - 1);
+}
+
+// Obtiene la casilla k-sima de una unidad: tipo 0 = fila, 1 = columna, 2 = caja
+void celdaDeUnidad(int tipo, int indice, int k, int subSize, int& fila, int& col);
+
+// Singles ocultos de la unidad u (ndices [0, d) filas, [d, 2d) columnas, [2d, 3d) cajas):
+// nmeros que faltan en la unidad y caben en una sola de sus casillas segn candidatos.
+// En sinCasilla quedan los nmeros que faltan y no caben en ninguna casilla.
+MascaraCandidatos singlesOcultosDeUnidad(const std::vector<MascaraCandidatos>& candidatos, int dimension, int subSize,
+	int u, MascaraCandidatos usados, MascaraCandidatos& sinCasilla);
+
+// Resultados de la propagacin por oleadas
+struct EstadisticasPropagacion {
+	int oleadas = 0;                        // Oleadas ejecutadas hasta el punto fijo
+	int celdasAsignadas = 0;                // Casillas fijadas por la propagacin
+	bool contradiccion = false;             // El tablero no tiene solucin
+	std::vector<double> tiempoPorOleadaMs;  // Duracin de cada oleada
+	double tiempoTotalMs = 0.0;
+};
+
+// Propaga singles desnudos y ocultos en oleadas paralelas hasta llegar a un punto fijo.
+// Cada oleada lee el tablero sin modificarlo, propone asignaciones de forma atmica
+// y solo las aplica despus de la barrera, por lo que las unidades se procesan en paralelo.
+EstadisticasPropagacion propagarPorOleadas(int** board, int dimension);
+
+// Imprime el nmero de oleadas y el tiempo de cada una
+void imprimirEstadisticasPropagacion(const EstadisticasPropagacion& estadisticas);
+
+// Propaga por oleadas y despus resuelve con backtracking lo que quede
+void resolverSudokuConOleadas(const std::vector<std::vector<int>>& initialBoard);
+
+#endif // PROPAGACION_H
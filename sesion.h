@@ -0,0 +1,70 @@
+#ifndef SESION_H
+#define SESION_H
+
+#include <vector>
+#include <iostream>
+#include "propagacion.h" // MascaraCandidatos y utilidades de bits
+
+// Tipos de pista que puede devolver la sesin
+enum TipoPista {
+	PISTA_NINGUNA,
+	PISTA_SINGLE_DESNUDO,  // La casilla solo admite un nmero
+	PISTA_SINGLE_OCULTO    // El nmero solo cabe en esa casilla de una fila, columna o caja
+};
+
+struct Pista {
+	TipoPista tipo = PISTA_NINGUNA;
+	int fila = -1;
+	int columna = -1;
+	int num = 0;
+};
+
+// Sesin de edicin incremental. Cada edicin actualiza en O(1) los conteos por unidad,
+// las mscaras de nmeros usados y el nmero de conflictos; las pistas y la comprobacin
+// de si el tablero sigue teniendo solucin se calculan solo cuando se piden.
+struct SesionSudoku {
+	int dimension = 0;
+	int subSize = 0;
+	std::vector<int> celdas;                     // Valor de cada casilla (0 = vaca), fila * dimension + col
+	std::vector<int> conteoUnidad;               // Apariciones de cada nmero en cada unidad: [unidad * (dimension + 1) + num]
+	std::vector<MascaraCandidatos> usadosUnidad; // Nmeros presentes en cada unidad: filas, columnas y cajas
+	int conflictos = 0;                          // Apariciones repetidas de un nmero dentro de una unidad
+	unsigned long long version = 0;              // Aumenta con cada edicin
+
+	// Pista calculada para la versin indicada
+	Pista pistaCacheada;
+	unsigned long long versionPista = ~0ULL;
+
+	// ltima solucin encontrada y casillas colocadas que no coinciden con ella
+	std::vector<int> solucionCacheada;
+	int discrepancias = 0;
+	// El tablero no tiene solucin; sigue siendo cierto mientras solo se coloquen nmeros
+	bool irresolubleCacheado = false;
+	unsigned long long nodosBusqueda = 0;        // Nodos de la ltima bsqueda completa
+};
+
+// Carga el tablero inicial; falla si la dimensin no es un cuadrado perfecto de hasta 64
+bool iniciarSesion(SesionSudoku& sesion, const std::vector<std::vector<int>>& initialBoard);
+
+// Coloca num en la casilla (reemplaza el valor anterior). Se permiten conflictos, que esValida reporta
+bool colocarNumero(SesionSudoku& sesion, int fila, int col, int num);
+
+// Vaca la casilla
+bool borrarNumero(SesionSudoku& sesion, int fila, int col);
+
+// Ningn nmero est repetido en una fila, columna o caja
+bool esValida(const SesionSudoku& sesion);
+
+// Nmeros posibles para la casilla segn los nmeros ya colocados
+MascaraCandidatos candidatosCasilla(const SesionSudoku& sesion, int fila, int col);
+
+// Siguiente casilla forzada (single desnudo u oculto); tipo PISTA_NINGUNA si no hay
+Pista siguientePista(SesionSudoku& sesion);
+
+// El tablero actual todava tiene al menos una solucin
+bool sigueResoluble(SesionSudoku& sesion);
+
+// Sesin interactiva por consola sobre uno de los tableros de ejemplo
+void ejecutarSesionInteractiva(const std::vector<std::vector<int>>& initialBoard);
+
+#endif // SESION_H
@@ -0,0 +1,56 @@
+#ifndef SHARDS_H
+#define SHARDS_H
+
+#include <vector>
+#include <iostream>
+#include <string>
+
+// Reparto del espacio de bsqueda entre procesos que comparten un directorio.
+//
+// Estructura del directorio:
+//   trabajo.txt                 huella del tablero inicial (huellaTablero) que identifica el trabajo
+//   shard_NNNNNN.txt            subproblema pendiente (tablero con las primeras casillas fijadas)
+//   shard_NNNNNN.txt.<worker>   subproblema reclamado por un worker
+//   shard_NNNNNN.hecho          subproblema explorado sin solucin
+//   shard_NNNNNN.ajeno          shard con la huella de otro trabajo, que no se explora
+//   shard_NNNNNN.error          shard que no se pudo leer
+//   solucion.txt                primera solucin publicada
+//   SOLUCION_ENCONTRADA         marcador que detiene al resto de workers
+//
+// Los shards, la solucin y el marcador empiezan por la huella del trabajo; los workers
+// ignoran los que no coinciden con la de trabajo.txt.
+//
+// Reclamar un shard es renombrarlo: solo un proceso puede renombrar el archivo original,
+// y el renombrado es atmico en un mismo sistema de archivos (local o compartido).
+
+const std::string MARCADOR_SOLUCION = "SOLUCION_ENCONTRADA";
+const std::string ARCHIVO_SOLUCION = "solucion.txt";
+const std::string ARCHIVO_TRABAJO = "trabajo.txt";
+
+// Procesos worker que se pueden lanzar desde el men en la mquina local
+const int MAXIMO_WORKERS_LOCALES = 64;
+
+// Lee un tablero de un archivo de texto: el tamao y despus una fila por lnea, con 0 en
+// las casillas vacas. Devuelve un tablero vaco si el archivo no existe o no es vlido.
+std::vector<std::vector<int>> leerTableroInicial(const std::string& ruta);
+
+// Expande el rbol de bsqueda hasta profundidadFrontera casillas vacas (en el orden de
+// solveSudoku) y escribe cada rama viable como un shard. Devuelve el nmero de shards,
+// o -1 si el directorio ya existe y no est vaco o si falla alguna escritura.
+int generarShards(const std::vector<std::vector<int>>& initialBoard, const std::string& directorio, int profundidadFrontera);
+
+// Reclama y resuelve shards hasta que no queden o aparezca el marcador de solucin.
+// Devuelve true si este worker public la solucin.
+bool ejecutarWorker(const std::string& directorio);
+
+// Lanza numWorkers procesos "programa --worker directorio" en la mquina local y espera a que terminen
+void lanzarWorkersLocales(const std::string& programa, const std::string& directorio, int numWorkers);
+
+// Lee la solucin publicada en el directorio (tablero vaco si no existe o es de otro trabajo)
+std::vector<std::vector<int>> leerSolucionPublicada(const std::string& directorio, unsigned long long huella);
+
+// Genera los shards, lanza los workers locales e imprime la solucin publicada
+void resolverSudokuConShards(const std::vector<std::vector<int>>& initialBoard, const std::string& programa,
+	int numWorkers, int profundidadFrontera);
+
+#endif // SHARDS_H
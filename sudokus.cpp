@@ -9,6 +9,7 @@
 #include <omp.h>
 #include <random>
 #include <iomanip> // Para formatear la salida
+#include <limits>  // Para descartar entradas no numricas
 
 #include "sudokus.h"
 
@@ -50,6 +51,56 @@ void printBoard(int** board, int size) {
     std::cout << "}" << std::endl;
 }
 
+// Funcin para copiar un tablero con memoria dinmica
+int** copiarTablero(int** board, int size) {
+    int** copia = new int* [size];
+    for (int i = 0; i < size; i++) {
+        copia[i] = new int[size];
+        for (int j = 0; j < size; j++) {
+            copia[i][j] = board[i][j];
+        }
+    }
+    return copia;
+}
+
+// Funcin para comprobar que board es una solucin completa y vlida de inicial:
+// todas las casillas entre 1 y size, sin repetidos por fila, columna o subcuadrcula
+// y respetando los nmeros dados
+bool validarSolucion(int** board, int** inicial, int size) {
+    int subSize = static_cast<int>(std::sqrt(size));
+    if (subSize * subSize != size) return false;
+
+    // Marcas de nmeros vistos por unidad: filas, columnas y subcuadrculas
+    std::vector<char> vistoFila(size * (size + 1), 0);
+    std::vector<char> vistoColumna(size * (size + 1), 0);
+    std::vector<char> vistoCaja(size * (size + 1), 0);
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            int num = board[i][j];
+            if (num < 1 || num > size) return false;
+            if (inicial[i][j] != 0 && inicial[i][j] != num) return false;
+
+            int caja = (i / subSize) * subSize + j / subSize;
+            char& fila = vistoFila[i * (size + 1) + num];
+            char& columna = vistoColumna[j * (size + 1) + num];
+            char& subcuadro = vistoCaja[caja * (size + 1) + num];
+            if (fila || columna || subcuadro) return false;
+            fila = columna = subcuadro = 1;
+        }
+    }
+    return true;
+}
+
+// Lee un entero de la consola; si no es un nmero descarta la lnea y devuelve false
+bool leerEntero(int& valor) {
+    if (std::cin >> valor) return true;
+    if (!std::cin.eof()) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return false;
+}
+
 
 // Tablero de Sudoku 25x25 de dificultad media como ejemplo de entrada
 std::vector<std::vector<int>> board25x25_dificultad_media = {
@@ -28,5 +28,10 @@ extern std::vector<std::vector<int>> board25x25_dificultad_media;
 int** initializeBoard(const std::vector<std::vector<int>>& initialBoard);
 void freeBoard(int** board, int size);
 void printBoard(int** board, int size);
+int** copiarTablero(int** board, int size);
+bool validarSolucion(int** board, int** inicial, int size);
+
+// Lee un entero de la consola; si no es un nmero descarta la lnea y devuelve false
+bool leerEntero(int& valor);
 
 #endif // SUDOKUS_H
\ No newline at end of file